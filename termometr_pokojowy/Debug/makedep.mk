@@ -8,12 +8,18 @@ Source\crc8.c
 
 Source\croutine.c
 
+Source\display.c
+
 Source\ds18x20.c
 
+Source\keypad.c
+
 Source\list.c
 
 Source\onewire.c
 
+Source\ow_engine.c
+
 Source\portable\MemMang\heap_1.c
 
 Source\portable\port.c
@@ -0,0 +1,546 @@
+/*
+ * avrsim.c
+ *
+ * Simulated ATmega32 peripherals for the host build.
+ *
+ * Every avrsimSTEP_US microseconds SIGALRM advances the timers by the number
+ * of CPU cycles that elapsed on the thread CPU time clock and sets the
+ * matching TIFR flags.  If the I bit of SREG is set the enabled interrupts are
+ * then dispatched in vector priority order, with the I bit cleared for the
+ * duration of each handler, just as the hardware does.  A handler may switch
+ * task context (taskYIELD() from an ISR); it then completes when the
+ * interrupted task is resumed.
+ *
+ * The USART is modelled at the frame level: a frame written to UDR completes
+ * ten bit times later with the byte the line carried meanwhile, supplied by
+ * the device on the other end (vAvrSimUsartTransmit()).
+ *
+ * Simulated time is the CPU time of the (only) thread rather than the wall
+ * clock: the MCU is never descheduled, and the host running another process
+ * in the middle of a timed sequence would otherwise show up in it, e.g. as a
+ * 1-Wire write slot long enough to be taken for a reset.
+ */
+
+#include <errno.h>
+#include <signal.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include <avr/io.h>
+
+#include "avrsim.h"
+
+#define avrsimNS_PER_SECOND		1000000000ULL
+
+/* Registers of the simulated MCU. */
+volatile uint8_t SREG;
+volatile uint8_t PORTA, DDRA;
+volatile uint8_t PORTB, DDRB;
+volatile uint8_t PORTC, DDRC;
+volatile uint8_t PORTD, DDRD;
+volatile uint8_t TIMSK, TIFR;
+volatile uint8_t TCCR0, TCNT0, OCR0;
+volatile uint8_t TCCR2, TCNT2, OCR2;
+volatile uint8_t TCCR1A, TCCR1B;
+volatile uint16_t TCNT1, OCR1A, OCR1B, ICR1;
+volatile uint8_t UDR, UCSRA = _BV( UDRE ), UCSRB, UCSRC, UBRRH, UBRRL;
+
+/* Vectors defined by the application and the kernel port.  The ones not
+defined anywhere resolve to NULL and their flags are just cleared. */
+extern void __vector_4( void ) __attribute__ ( ( weak ) );
+extern void __vector_5( void ) __attribute__ ( ( weak ) );
+extern void __vector_6( void ) __attribute__ ( ( weak ) );
+extern void __vector_7( void ) __attribute__ ( ( weak ) );
+extern void __vector_8( void ) __attribute__ ( ( weak ) );
+extern void __vector_9( void ) __attribute__ ( ( weak ) );
+extern void __vector_10( void ) __attribute__ ( ( weak ) );
+extern void __vector_11( void ) __attribute__ ( ( weak ) );
+extern void __vector_13( void ) __attribute__ ( ( weak ) );
+
+typedef struct xAVRSIM_VECTOR
+{
+	volatile uint8_t *pucFlags;		/*< Flag register of the source. */
+	volatile uint8_t *pucMask;		/*< Enable register of the source. */
+	uint8_t ucBit;					/*< Bit of the source in both registers. */
+	uint8_t ucNumber;				/*< Vector number, __vector_n. */
+	void ( *pxHandler )( void );
+} xAvrSimVector;
+
+/* Timer and USART sources, highest priority (lowest vector number) first.
+RXC is cleared on dispatch, the handler has to read UDR anyway. */
+static const xAvrSimVector xVectors[] =
+{
+	{ &TIFR, &TIMSK, OCF2,	4,	__vector_4 },
+	{ &TIFR, &TIMSK, TOV2,	5,	__vector_5 },
+	{ &TIFR, &TIMSK, ICF1,	6,	__vector_6 },
+	{ &TIFR, &TIMSK, OCF1A,	7,	__vector_7 },
+	{ &TIFR, &TIMSK, OCF1B,	8,	__vector_8 },
+	{ &TIFR, &TIMSK, TOV1,	9,	__vector_9 },
+	{ &TIFR, &TIMSK, OCF0,	10,	__vector_10 },
+	{ &TIFR, &TIMSK, TOV0,	11,	__vector_11 },
+	{ &UCSRA, &UCSRB, RXC,	13,	__vector_13 }
+};
+
+#define avrsimNUM_VECTORS		( sizeof( xVectors ) / sizeof( xVectors[ 0 ] ) )
+
+static volatile uint8_t * const pucPorts[ avrsimNUM_PORTS ] = { &PORTA, &PORTB, &PORTC, &PORTD };
+static volatile uint8_t * const pucDdrs[ avrsimNUM_PORTS ] = { &DDRA, &DDRB, &DDRC, &DDRD };
+static pxAvrSimPinSource pxPinSources[ avrsimNUM_PORTS ];
+
+/* Prescaler residues of the timers, in CPU cycles. */
+static uint32_t ulTimer0Residue, ulTimer1Residue, ulTimer2Residue;
+
+static uint64_t ullResetTime, ullLastStep, ullCycleResidue;
+
+/* Frame being shifted by the USART: time it completes (0 = none) and the
+byte it brings in. */
+static uint64_t ullUsartDone;
+static uint8_t ucUsartReceived;
+
+/* Executed interrupts, in total and per entry of xVectors[], the count at
+sleep_enable(), the start of the current sleep (0 = awake) and the time
+spent asleep until the interrupts that ended the sleeps. */
+static volatile uint32_t ulInterruptsTaken;
+static uint32_t ulVectorCounts[ sizeof( xVectors ) / sizeof( xVectors[ 0 ] ) ];
+static uint32_t ulInterruptsAtSleepEnable;
+static volatile uint64_t ullSleepStart;
+static uint64_t ullSleepNs;
+
+static const uint16_t usTimer01Prescaler[ 8 ] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+static const uint16_t usTimer2Prescaler[ 8 ] = { 0, 1, 8, 32, 64, 128, 256, 1024 };
+
+static void prvAvrSimInit( void ) __attribute__ ( ( constructor ) );
+static void prvStep( int iSignal );
+static void prvDispatch( void );
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNow( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_THREAD_CPUTIME_ID, &xNow );
+	return ( uint64_t ) xNow.tv_sec * avrsimNS_PER_SECOND + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Advance one counter by ulCounts timer clocks.  ulTop is the value at which
+ * the counter wraps (OCR in CTC mode, MAX otherwise).  Sets the TIFR bit
+ * pucCompareBit[ n ] for every compare value pulCompare[ n ] that was reached
+ * and ucOverflowBit when the counter wrapped past MAX in normal mode.
+ */
+static uint32_t prvCount( uint32_t ulCount, uint32_t ulCounts, uint32_t ulTop, const uint32_t *pulCompare, const uint8_t *pucCompareBit, uint8_t ucNumCompare, uint8_t ucOverflowBit, uint8_t xOverflowAtTop )
+{
+uint32_t ulPeriod = ulTop + 1UL, ulDistance;
+uint8_t ucCompare;
+
+	for( ucCompare = 0; ucCompare < ucNumCompare; ucCompare++ )
+	{
+		ulDistance = ( pulCompare[ ucCompare ] + ulPeriod - ( ulCount % ulPeriod ) ) % ulPeriod;
+		if( ulDistance == 0UL )
+		{
+			ulDistance = ulPeriod;
+		}
+
+		if( ( pulCompare[ ucCompare ] <= ulTop ) && ( ulDistance <= ulCounts ) )
+		{
+			TIFR |= ( uint8_t ) _BV( pucCompareBit[ ucCompare ] );
+		}
+	}
+
+	if( ( xOverflowAtTop != 0 ) && ( ( ulCount + ulCounts ) >= ulPeriod ) )
+	{
+		TIFR |= ( uint8_t ) _BV( ucOverflowBit );
+	}
+
+	return ( ulCount + ulCounts ) % ulPeriod;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAdvanceTimers( uint32_t ulCycles )
+{
+uint32_t ulPrescaler, ulCounts, ulTop, ulCompare[ 2 ];
+uint8_t ucBits[ 2 ];
+uint8_t xCtc;
+
+	/* Timer0 - normal or CTC mode. */
+	ulPrescaler = usTimer01Prescaler[ TCCR0 & 0x07 ];
+	if( ulPrescaler != 0UL )
+	{
+		ulTimer0Residue += ulCycles;
+		ulCounts = ulTimer0Residue / ulPrescaler;
+		ulTimer0Residue %= ulPrescaler;
+
+		xCtc = ( TCCR0 & _BV( WGM01 ) ) != 0;
+		ulTop = xCtc ? OCR0 : 0xFFUL;
+		ulCompare[ 0 ] = OCR0;
+		ucBits[ 0 ] = OCF0;
+		TCNT0 = ( uint8_t ) prvCount( TCNT0, ulCounts, ulTop, ulCompare, ucBits, 1, TOV0, !xCtc );
+	}
+
+	/* Timer1 - normal or CTC (OCR1A) mode. */
+	ulPrescaler = usTimer01Prescaler[ TCCR1B & 0x07 ];
+	if( ulPrescaler != 0UL )
+	{
+		ulTimer1Residue += ulCycles;
+		ulCounts = ulTimer1Residue / ulPrescaler;
+		ulTimer1Residue %= ulPrescaler;
+
+		xCtc = ( TCCR1B & _BV( WGM12 ) ) != 0;
+		ulTop = xCtc ? OCR1A : 0xFFFFUL;
+		ulCompare[ 0 ] = OCR1A;
+		ucBits[ 0 ] = OCF1A;
+		ulCompare[ 1 ] = OCR1B;
+		ucBits[ 1 ] = OCF1B;
+		TCNT1 = ( uint16_t ) prvCount( TCNT1, ulCounts, ulTop, ulCompare, ucBits, 2, TOV1, !xCtc );
+	}
+
+	/* Timer2 - normal or CTC mode, synchronous clock only. */
+	ulPrescaler = usTimer2Prescaler[ TCCR2 & 0x07 ];
+	if( ulPrescaler != 0UL )
+	{
+		ulTimer2Residue += ulCycles;
+		ulCounts = ulTimer2Residue / ulPrescaler;
+		ulTimer2Residue %= ulPrescaler;
+
+		xCtc = ( TCCR2 & _BV( WGM21 ) ) != 0;
+		ulTop = xCtc ? OCR2 : 0xFFUL;
+		ulCompare[ 0 ] = OCR2;
+		ucBits[ 0 ] = OCF2;
+		TCNT2 = ( uint8_t ) prvCount( TCNT2, ulCounts, ulTop, ulCompare, ucBits, 1, TOV2, !xCtc );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Advance the timers to the current time.  Runs with SIGALRM blocked.
+ */
+static void prvSync( void )
+{
+uint64_t ullNow, ullElapsed;
+
+	ullNow = prvNow();
+	ullElapsed = ( ullNow - ullLastStep ) * ( uint64_t ) F_CPU + ullCycleResidue;
+	ullLastStep = ullNow;
+	ullCycleResidue = ullElapsed % avrsimNS_PER_SECOND;
+
+	prvAdvanceTimers( ( uint32_t ) ( ullElapsed / avrsimNS_PER_SECOND ) );
+
+	if( ( ullUsartDone != 0ULL ) && ( ullNow >= ullUsartDone ) )
+	{
+		ullUsartDone = 0ULL;
+		UDR = ucUsartReceived;
+		UCSRA |= ( uint8_t ) ( _BV( RXC ) | _BV( TXC ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Microseconds until an 8-bit counter reaches its compare value, rounded up.
+ */
+static uint32_t prvUsToCompare( uint8_t ucCount, uint8_t ucCompare, uint32_t ulPrescaler, uint32_t ulResidue )
+{
+uint32_t ulCounts, ulCycles;
+
+	ulCounts = ( ucCompare >= ucCount ) ? ( uint32_t ) ( ucCompare - ucCount ) : ( uint32_t ) ( 0x100 - ucCount + ucCompare );
+	if( ulCounts == 0UL )
+	{
+		ulCounts = 1UL;
+	}
+	ulCycles = ulCounts * ulPrescaler - ulResidue;
+	return ( uint32_t ) ( ( ( uint64_t ) ulCycles * 1000000ULL + F_CPU - 1 ) / F_CPU );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Timer2 (the 1-Wire slots), Timer0 (the display, which may switch a dimmed
+ * digit off within its slot) and the USART produce events shorter than the
+ * step, so the next SIGALRM is brought forward to the compare match or the
+ * end of the USART frame when that comes before the regular step.
+ */
+static void prvArmNextStep( void )
+{
+struct itimerval xTimer;
+uint32_t ulPrescaler, ulUs = avrsimSTEP_US, ulCompareUs, ulFrameUs;
+uint64_t ullNow;
+
+	ulPrescaler = usTimer2Prescaler[ TCCR2 & 0x07 ];
+	if( ( ulPrescaler != 0UL ) && ( ( TIMSK & _BV( OCIE2 ) ) != 0 ) && ( ( TIFR & _BV( OCF2 ) ) == 0 ) )
+	{
+		ulUs = prvUsToCompare( TCNT2, OCR2, ulPrescaler, ulTimer2Residue );
+	}
+
+	ulPrescaler = usTimer01Prescaler[ TCCR0 & 0x07 ];
+	if( ( ulPrescaler != 0UL ) && ( ( TIMSK & _BV( OCIE0 ) ) != 0 ) && ( ( TIFR & _BV( OCF0 ) ) == 0 ) )
+	{
+		ulCompareUs = prvUsToCompare( TCNT0, OCR0, ulPrescaler, ulTimer0Residue );
+		if( ulCompareUs < ulUs )
+		{
+			ulUs = ulCompareUs;
+		}
+	}
+
+	if( ullUsartDone != 0ULL )
+	{
+		ullNow = prvNow();
+		ulFrameUs = ( ullUsartDone > ullNow ) ? ( uint32_t ) ( ( ullUsartDone - ullNow + 999ULL ) / 1000ULL ) : 0UL;
+		if( ulFrameUs < ulUs )
+		{
+			ulUs = ulFrameUs;
+		}
+	}
+
+	if( ulUs < avrsimSTEP_US )
+	{
+		xTimer.it_interval.tv_sec = 0;
+		xTimer.it_interval.tv_usec = avrsimSTEP_US;
+		xTimer.it_value.tv_sec = 0;
+		xTimer.it_value.tv_usec = ( ulUs != 0UL ) ? ulUs : 1;
+		setitimer( ITIMER_REAL, &xTimer, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Take every pending, enabled interrupt while the I bit stays set.  Runs with
+ * SIGALRM blocked, either from the signal handler itself or from the handler
+ * invoked by vAvrSimInterruptsEnabled().
+ */
+static void prvDispatch( void )
+{
+uint8_t ucVector;
+const xAvrSimVector *pxVector;
+
+	while( ( SREG & avrsimSREG_I ) != 0 )
+	{
+		pxVector = NULL;
+		for( ucVector = 0; ucVector < avrsimNUM_VECTORS; ucVector++ )
+		{
+			if( ( *xVectors[ ucVector ].pucFlags & *xVectors[ ucVector ].pucMask & _BV( xVectors[ ucVector ].ucBit ) ) != 0 )
+			{
+				pxVector = &xVectors[ ucVector ];
+				break;
+			}
+		}
+
+		if( pxVector == NULL )
+		{
+			break;
+		}
+
+		/* The flag is cleared by hardware when the vector is executed. */
+		*pxVector->pucFlags &= ( uint8_t ) ~_BV( pxVector->ucBit );
+
+		if( pxVector->pxHandler != NULL )
+		{
+			if( ullSleepStart != 0ULL )
+			{
+				ullSleepNs += prvNow() - ullSleepStart;
+				ullSleepStart = 0ULL;
+			}
+			ulVectorCounts[ pxVector - xVectors ]++;
+			ulInterruptsTaken++;
+			SREG &= ( uint8_t ) ~avrsimSREG_I;
+			pxVector->pxHandler();
+			SREG |= avrsimSREG_I;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStep( int iSignal )
+{
+int iSavedErrno = errno;
+
+	( void ) iSignal;
+
+	prvSync();
+	prvDispatch();
+	prvArmNextStep();
+
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAvrSimInit( void )
+{
+struct sigaction xAction;
+struct itimerval xTimer;
+
+	/* The MCU comes out of reset with interrupts disabled. */
+	SREG = 0;
+	ullResetTime = prvNow();
+	ullLastStep = ullResetTime;
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvStep;
+	xAction.sa_flags = SA_RESTART;
+	sigemptyset( &xAction.sa_mask );
+	sigaction( SIGALRM, &xAction, NULL );
+
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = avrsimSTEP_US;
+	xTimer.it_value = xTimer.it_interval;
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+}
+/*-----------------------------------------------------------*/
+
+uint8_t ucAvrSimReadPin( uint8_t ucPort )
+{
+uint8_t ucDdr = *pucDdrs[ ucPort ];
+uint8_t ucLevel = ( uint8_t ) ( ( ucDdr & *pucPorts[ ucPort ] ) | ( uint8_t ) ~ucDdr );
+
+	if( pxPinSources[ ucPort ] != NULL )
+	{
+		ucLevel &= ( uint8_t ) ~pxPinSources[ ucPort ]();
+	}
+
+	return ucLevel;
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimSetPinSource( uint8_t ucPort, pxAvrSimPinSource pxSource )
+{
+	pxPinSources[ ucPort ] = pxSource;
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimInterruptsEnabled( void )
+{
+	/* Let the signal handler dispatch whatever became pending while the I bit
+	was clear - it is the only place where TIFR is modified. */
+	if( ( ( TIFR & TIMSK ) != 0 ) || ( ( UCSRA & UCSRB & _BV( RXC ) ) != 0 ) )
+	{
+		raise( SIGALRM );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimDelayUs( double dUs )
+{
+uint64_t ullEnd = prvNow() + ( uint64_t ) ( dUs * 1000.0 );
+
+	while( prvNow() < ullEnd )
+	{
+		/* Busy wait, as the MCU does. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulAvrSimMicros( void )
+{
+	return ( uint32_t ) ( ( prvNow() - ullResetTime ) / 1000ULL );
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimSyncTimers( void )
+{
+sigset_t xSignals, xPrevious;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, SIGALRM );
+	sigprocmask( SIG_BLOCK, &xSignals, &xPrevious );
+	prvSync();
+	sigprocmask( SIG_SETMASK, &xPrevious, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimTimersWritten( void )
+{
+sigset_t xSignals, xPrevious;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, SIGALRM );
+	sigprocmask( SIG_BLOCK, &xSignals, &xPrevious );
+	prvArmNextStep();
+	sigprocmask( SIG_SETMASK, &xPrevious, NULL );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulAvrSimUsartBitNs( void )
+{
+uint32_t ulDivider = ( ( UCSRA & _BV( U2X ) ) != 0 ) ? 8UL : 16UL;
+uint32_t ulUbrr = ( ( uint32_t ) ( UBRRH & 0x0F ) << 8 ) | UBRRL;
+
+	return ( uint32_t ) ( ( uint64_t ) ulDivider * ( ulUbrr + 1UL ) * avrsimNS_PER_SECOND / F_CPU );
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimUsartTransmit( uint8_t ucReceived )
+{
+sigset_t xSignals, xPrevious;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, SIGALRM );
+	sigprocmask( SIG_BLOCK, &xSignals, &xPrevious );
+
+	prvSync();
+	UCSRA &= ( uint8_t ) ~( _BV( RXC ) | _BV( TXC ) );
+	ucUsartReceived = ucReceived;
+	ullUsartDone = prvNow() + 10ULL * ulAvrSimUsartBitNs();
+	prvArmNextStep();
+
+	sigprocmask( SIG_SETMASK, &xPrevious, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimClearTimerFlags( uint8_t ucFlags )
+{
+sigset_t xSignals, xPrevious;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, SIGALRM );
+	sigprocmask( SIG_BLOCK, &xSignals, &xPrevious );
+	TIFR &= ( uint8_t ) ~ucFlags;
+	sigprocmask( SIG_SETMASK, &xPrevious, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimSleepEnable( void )
+{
+	ulInterruptsAtSleepEnable = ulInterruptsTaken;
+}
+/*-----------------------------------------------------------*/
+
+void vAvrSimSleep( void )
+{
+sigset_t xSignals, xPrevious;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, SIGALRM );
+	sigprocmask( SIG_BLOCK, &xSignals, &xPrevious );
+	if( ulInterruptsTaken == ulInterruptsAtSleepEnable )
+	{
+		ullSleepStart = prvNow();
+	}
+	sigprocmask( SIG_SETMASK, &xPrevious, NULL );
+
+	while( ulInterruptsTaken == ulInterruptsAtSleepEnable )
+	{
+		/* Busy wait, the simulated time is the CPU time of the thread. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulAvrSimSleepUs( void )
+{
+	return ( uint32_t ) ( ullSleepNs / 1000ULL );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulAvrSimInterrupts( uint8_t ucVector )
+{
+size_t xIndex;
+
+	for( xIndex = 0; xIndex < avrsimNUM_VECTORS; xIndex++ )
+	{
+		if( xVectors[ xIndex ].ucNumber == ucVector )
+		{
+			return ulVectorCounts[ xIndex ];
+		}
+	}
+
+	return 0UL;
+}
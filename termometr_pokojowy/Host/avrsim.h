@@ -0,0 +1,79 @@
+/*
+ * avrsim.h
+ *
+ * Simulated ATmega32 used by the host (Linux) build.  The I/O registers the
+ * firmware touches are plain variables, the timers are advanced from the CPU
+ * time of the host thread and the interrupt vectors are dispatched from SIGALRM,
+ * honouring the I bit of the simulated SREG.
+ */
+
+#ifndef AVRSIM_H_
+#define AVRSIM_H_
+
+#include <inttypes.h>
+
+/* Global interrupt enable bit of SREG. */
+#define avrsimSREG_I			( ( uint8_t ) 0x80 )
+
+/* Indexes of the I/O ports, as passed to ucAvrSimReadPin(). */
+#define avrsimPORTA				0
+#define avrsimPORTB				1
+#define avrsimPORTC				2
+#define avrsimPORTD				3
+#define avrsimNUM_PORTS			4
+
+/* Interval at which the simulated peripherals are advanced. */
+#define avrsimSTEP_US			250
+
+/* Current input level of a port: outputs read back their PORT value, inputs
+float high unless an external device pulls them low. */
+uint8_t ucAvrSimReadPin( uint8_t ucPort );
+
+/* Attach the devices connected to ucPort.  pxSource returns the pins they
+currently pull low (keys, 1-Wire slaves) and is called on every PINx read. */
+typedef uint8_t ( *pxAvrSimPinSource )( void );
+void vAvrSimSetPinSource( uint8_t ucPort, pxAvrSimPinSource pxSource );
+
+/* Called after the I bit has been set from task level, so that interrupts
+which became pending while it was clear are taken immediately. */
+void vAvrSimInterruptsEnabled( void );
+
+/* Busy wait used by _delay_us()/_delay_ms(). */
+void vAvrSimDelayUs( double dUs );
+
+/* Microseconds of simulated time since reset. */
+uint32_t ulAvrSimMicros( void );
+
+/* Timer registers are only brought up to date on each step.  Code writing a
+counter or compare register calls vAvrSimSyncTimers() before the write, so
+that the time elapsed so far is counted with the old settings, and
+vAvrSimTimersWritten() after it, so that a compare match sooner than the
+next step is not taken late. */
+void vAvrSimSyncTimers( void );
+void vAvrSimTimersWritten( void );
+
+/* Writing ones to TIFR clears those flags on the MCU, here TIFR is a plain
+variable also set by the SIGALRM handler.  Task level code clears flags with
+this call instead.  The timers are not synchronised first: the flags cleared
+are those set up to the last vAvrSimSyncTimers() or step. */
+void vAvrSimClearTimerFlags( uint8_t ucFlags );
+
+/* Idle sleep mode, see avr/sleep.h.  vAvrSimSleepEnable() marks the point
+from which a taken interrupt ends the next vAvrSimSleep(). */
+void vAvrSimSleepEnable( void );
+void vAvrSimSleep( void );
+
+/* Microseconds of simulated time spent in vAvrSimSleep() and the number of
+times the given vector (__vector_n) has been executed. */
+uint32_t ulAvrSimSleepUs( void );
+uint32_t ulAvrSimInterrupts( uint8_t ucVector );
+
+/* Bit time of the USART at the current UBRR and U2X settings. */
+uint32_t ulAvrSimUsartBitNs( void );
+
+/* A frame was written to UDR (8N1, no parity) and ucReceived is what the
+receiver reads back from the line at the end of it, when RXC gets set.  One
+frame at a time: the caller waits for RXC before writing the next one. */
+void vAvrSimUsartTransmit( uint8_t ucReceived );
+
+#endif /* AVRSIM_H_ */
@@ -0,0 +1,406 @@
+/*
+ * dispcheck.c
+ *
+ * Decodes the display from a pin trace of the host build (TERMOMETR_TRACE,
+ * see hal_host.h) into the screens shown, one line per screen, for comparing
+ * with the expected output ("make check").
+ *
+ * Every digit slot is taken from the writes to the digit and segment ports:
+ * the segments present while the digit is selected and the time it stays
+ * selected.  A full scan of NUMBER_OF_DIGITS slots from digit 0 on is a
+ * frame.  Repeated frames make one screen, and a screen alternating every
+ * DISPLAY_BLINK_FRAMES scans with a copy of itself with some digits blanked is
+ * one blinking screen.  A line reads
+ *
+ *   <text> <level of each digit> [blink <digits>]
+ *
+ * with the leftmost digit first, ' ' for a blank digit, '_' for a pattern
+ * that is neither a digit nor a sign, and the on-time of each digit in
+ * display_set_level() steps, 1 ... DISPLAY_LEVELS.
+ *
+ * A frame shown for only a few scans between two screens must be one of them,
+ * with a digit at a wrong level at most (a slot cut short by the host
+ * scheduler, see dispMIN_SCANS).  Any other - some digits of the old screen
+ * and some of the new one, what the double buffer of display.c is there to
+ * prevent - is reported as torn, printed as a screen of its own and makes the
+ * exit status non-zero.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* display.h and hal.h, kept in step by hand: the tool is built without the
+firmware headers. */
+#define dispDIGITS				4
+#define dispSLOT_US				( 31UL * 64UL )
+#define dispLEVELS				8
+#define dispBLINK_FRAMES		64
+#define dispDP					0x80
+
+#define dispMAX_RUNS			4096
+
+/* Frames held for fewer scans are no screen of their own.  The simulated time
+is the CPU time of the host thread, so a slot cut short by the host scheduler
+shows as a frame with a digit at a wrong level; it is counted to the screen it
+belongs to, see prvShortFrom(). */
+#define dispMIN_SCANS			4
+
+#define dispFROM_BEFORE			0x01
+#define dispFROM_AFTER			0x02
+
+typedef struct xDISP_FRAME
+{
+	unsigned char ucSeg[ dispDIGITS ];		/*< Segments lit, [0] is the rightmost digit. */
+	unsigned char ucLevel[ dispDIGITS ];
+} xDispFrame;
+
+typedef struct xDISP_RUN
+{
+	xDispFrame xFrame;
+	unsigned long ulScans;
+	unsigned long ulStartUs;				/*< Trace time of the first scan. */
+} xDispRun;
+
+static xDispRun xRuns[ dispMAX_RUNS ];
+static size_t xNumRuns;
+static unsigned long ulTornFrames;
+
+static void prvPrintScreen( const xDispFrame *pxFrame, unsigned char ucBlink, FILE *pxOut );
+/*-----------------------------------------------------------*/
+
+static char prvSegChar( unsigned char ucSeg )
+{
+static const unsigned char ucDigits[ 10 ] = { 0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f };
+int i;
+
+	ucSeg &= ( unsigned char ) ~dispDP;
+	if( ucSeg == 0x00 ) return ' ';
+	if( ucSeg == 0x40 ) return '-';
+	if( ucSeg == 0x50 ) return 'r';
+	for( i = 0; i < 10; i++ )
+	{
+		if( ucSeg == ucDigits[ i ] ) return ( char ) ( '0' + i );
+	}
+	return '_';
+}
+/*-----------------------------------------------------------*/
+
+/* Screen of a digit of a short frame: dispFROM_BEFORE, dispFROM_AFTER, both,
+or none for segments of neither screen.  A digit is of a screen with the same
+segments and a level at most one step off; a digit with the segments of a
+screen but a level further off is a slot cut short and is taken as of that
+screen whatever the level. */
+static unsigned char prvDigitFrom( const xDispFrame *pxShort, const xDispFrame *pxBefore, const xDispFrame *pxAfter, int i )
+{
+unsigned char ucFrom = 0;
+
+	if( ( pxShort->ucSeg[ i ] == pxBefore->ucSeg[ i ] ) && ( abs( ( int ) pxShort->ucLevel[ i ] - ( int ) pxBefore->ucLevel[ i ] ) <= 1 ) )
+	{
+		ucFrom |= dispFROM_BEFORE;
+	}
+	if( ( pxShort->ucSeg[ i ] == pxAfter->ucSeg[ i ] ) && ( abs( ( int ) pxShort->ucLevel[ i ] - ( int ) pxAfter->ucLevel[ i ] ) <= 1 ) )
+	{
+		ucFrom |= dispFROM_AFTER;
+	}
+
+	if( ucFrom == 0 )
+	{
+		if( pxShort->ucSeg[ i ] == pxBefore->ucSeg[ i ] )
+		{
+			ucFrom |= dispFROM_BEFORE;
+		}
+		if( pxShort->ucSeg[ i ] == pxAfter->ucSeg[ i ] )
+		{
+			ucFrom |= dispFROM_AFTER;
+		}
+	}
+
+	return ucFrom;
+}
+/*-----------------------------------------------------------*/
+
+/* Screen a short frame belongs to, dispFROM_BEFORE or dispFROM_AFTER, or 0 if
+it is torn: a digit of neither screen, or digits of only the screen before
+together with digits of only the one after. */
+static unsigned char prvShortFrom( const xDispFrame *pxShort, const xDispFrame *pxBefore, const xDispFrame *pxAfter )
+{
+unsigned char ucFrom, ucOnly = 0;
+int i;
+
+	for( i = 0; i < dispDIGITS; i++ )
+	{
+		ucFrom = prvDigitFrom( pxShort, pxBefore, pxAfter, i );
+		if( ucFrom == 0 )
+		{
+			return 0;
+		}
+		if( ucFrom != ( dispFROM_BEFORE | dispFROM_AFTER ) )
+		{
+			ucOnly |= ucFrom;
+		}
+	}
+
+	if( ucOnly == ( dispFROM_BEFORE | dispFROM_AFTER ) )
+	{
+		return 0;
+	}
+
+	return ( ucOnly == dispFROM_AFTER ) ? dispFROM_AFTER : dispFROM_BEFORE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddFrame( const xDispFrame *pxFrame, unsigned long ulTimeUs )
+{
+xDispRun *pxShort;
+unsigned long ulCarried = 0;
+unsigned char ucFrom;
+
+	/* A short run ends here: count it to the screen before or to this one,
+	or report it. */
+	if( ( xNumRuns > 1 ) && ( xRuns[ xNumRuns - 1 ].ulScans < dispMIN_SCANS ) &&
+		( memcmp( &( xRuns[ xNumRuns - 1 ].xFrame ), pxFrame, sizeof( xDispFrame ) ) != 0 ) )
+	{
+		pxShort = &( xRuns[ xNumRuns - 1 ] );
+		ucFrom = prvShortFrom( &( pxShort->xFrame ), &( xRuns[ xNumRuns - 2 ].xFrame ), pxFrame );
+		if( ucFrom == dispFROM_BEFORE )
+		{
+			xRuns[ xNumRuns - 2 ].ulScans += pxShort->ulScans;
+			xNumRuns--;
+		}
+		else if( ucFrom == dispFROM_AFTER )
+		{
+			ulCarried = pxShort->ulScans;
+			ulTimeUs = pxShort->ulStartUs;
+			xNumRuns--;
+		}
+		else
+		{
+			fprintf( stderr, "dispcheck: torn frame at %lu us, %lu scans: ", pxShort->ulStartUs, pxShort->ulScans );
+			prvPrintScreen( &( pxShort->xFrame ), 0, stderr );
+			ulTornFrames++;
+		}
+	}
+
+	if( ( xNumRuns > 0 ) && ( memcmp( &( xRuns[ xNumRuns - 1 ].xFrame ), pxFrame, sizeof( xDispFrame ) ) == 0 ) )
+	{
+		xRuns[ xNumRuns - 1 ].ulScans += 1 + ulCarried;
+		return;
+	}
+
+	if( xNumRuns == dispMAX_RUNS )
+	{
+		fprintf( stderr, "dispcheck: more than %d screens\n", dispMAX_RUNS );
+		exit( EXIT_FAILURE );
+	}
+	xRuns[ xNumRuns ].xFrame = *pxFrame;
+	xRuns[ xNumRuns ].ulScans = 1 + ulCarried;
+	xRuns[ xNumRuns ].ulStartUs = ulTimeUs;
+	xNumRuns++;
+}
+/*-----------------------------------------------------------*/
+
+/* Mask of the digits blanked in pxOff that are lit in pxOn, 0 if pxOff is not
+pxOn with some digits blanked. */
+static unsigned char prvBlinkMask( const xDispFrame *pxOn, const xDispFrame *pxOff )
+{
+unsigned char ucMask = 0;
+int i;
+
+	for( i = 0; i < dispDIGITS; i++ )
+	{
+		if( pxOn->ucLevel[ i ] != pxOff->ucLevel[ i ] )
+		{
+			return 0;
+		}
+		if( pxOn->ucSeg[ i ] != pxOff->ucSeg[ i ] )
+		{
+			if( pxOff->ucSeg[ i ] != 0 )
+			{
+				return 0;
+			}
+			ucMask |= ( unsigned char ) ( 1U << i );
+		}
+	}
+
+	return ucMask;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintScreen( const xDispFrame *pxFrame, unsigned char ucBlink, FILE *pxOut )
+{
+int i;
+
+	for( i = dispDIGITS - 1; i >= 0; i-- )
+	{
+		fputc( prvSegChar( pxFrame->ucSeg[ i ] ), pxOut );
+		if( ( pxFrame->ucSeg[ i ] & dispDP ) != 0 )
+		{
+			fputc( '.', pxOut );
+		}
+	}
+	fputc( ' ', pxOut );
+	for( i = dispDIGITS - 1; i >= 0; i-- )
+	{
+		fputc( '0' + pxFrame->ucLevel[ i ], pxOut );
+	}
+	if( ucBlink != 0 )
+	{
+		fputs( " blink ", pxOut );
+		for( i = dispDIGITS - 1; i >= 0; i-- )
+		{
+			fputc( ( ( ucBlink & ( 1U << i ) ) != 0 ) ? 'x' : '.', pxOut );
+		}
+	}
+	fputc( '\n', pxOut );
+}
+/*-----------------------------------------------------------*/
+
+/* Blinking: runs alternating between a frame and the same frame with some
+digits blanked, each DISPLAY_BLINK_FRAMES scans long (give or take the folded
+short frames) except the first and the last one. */
+static void prvPrintScreens( void )
+{
+size_t xRun, xEnd;
+const xDispFrame *pxOn, *pxOff;
+unsigned char ucMask;
+
+	for( xRun = 0; xRun < xNumRuns; xRun = xEnd )
+	{
+		xEnd = xRun + 1;
+		ucMask = 0;
+
+		if( xRun + 1 < xNumRuns )
+		{
+			pxOn = &( xRuns[ xRun ].xFrame );
+			pxOff = &( xRuns[ xRun + 1 ].xFrame );
+			ucMask = prvBlinkMask( pxOn, pxOff );
+			if( ucMask == 0 )
+			{
+				pxOn = &( xRuns[ xRun + 1 ].xFrame );
+				pxOff = &( xRuns[ xRun ].xFrame );
+				ucMask = prvBlinkMask( pxOn, pxOff );
+			}
+
+			if( ( ucMask != 0 ) && ( xRuns[ xRun ].ulScans <= dispBLINK_FRAMES ) )
+			{
+				/* Take the runs while they alternate; all but the last must
+				be a full blink phase. */
+				xEnd = xRun + 2;
+				while( ( xEnd < xNumRuns ) && ( xRuns[ xEnd - 1 ].ulScans + dispMIN_SCANS > dispBLINK_FRAMES ) &&
+					   ( xRuns[ xEnd - 1 ].ulScans < dispBLINK_FRAMES + dispMIN_SCANS ) &&
+					   ( memcmp( &( xRuns[ xEnd ].xFrame ), &( xRuns[ xEnd - 2 ].xFrame ), sizeof( xDispFrame ) ) == 0 ) )
+				{
+					xEnd++;
+				}
+				if( ( xEnd - xRun ) < 3 )
+				{
+					/* A single change is no blinking. */
+					xEnd = xRun + 1;
+					ucMask = 0;
+				}
+			}
+			else
+			{
+				ucMask = 0;
+			}
+		}
+
+		if( ucMask != 0 )
+		{
+			prvPrintScreen( pxOn, ucMask, stdout );
+		}
+		else
+		{
+			prvPrintScreen( &( xRuns[ xRun ].xFrame ), 0, stdout );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+FILE *pxFile;
+char cLine[ 64 ], cPort;
+unsigned long ulTime;
+unsigned int uiValue;
+unsigned char ucSegments = 0, ucLevel;
+int iLit = -1, iNext = 0, i;
+unsigned long ulLitSince = 0, ulOn;
+xDispFrame xFrame;
+
+	if( argc != 2 )
+	{
+		fprintf( stderr, "usage: %s <trace file>\n", argv[ 0 ] );
+		return EXIT_FAILURE;
+	}
+
+	pxFile = fopen( argv[ 1 ], "r" );
+	if( pxFile == NULL )
+	{
+		perror( argv[ 1 ] );
+		return EXIT_FAILURE;
+	}
+
+	memset( &xFrame, 0, sizeof( xFrame ) );
+
+	while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+	{
+		if( sscanf( cLine, "%lu,%c,%x", &ulTime, &cPort, &uiValue ) != 3 )
+		{
+			continue;
+		}
+
+		if( cPort == 'C' )
+		{
+			/* Segments, active low. */
+			ucSegments = ( unsigned char ) ~uiValue;
+		}
+		else if( cPort == 'B' )
+		{
+			/* Digit select, active low: end of the slot of the digit lit
+			so far, then the one selected now. */
+			if( iLit >= 0 )
+			{
+				ulOn = ulTime - ulLitSince;
+				ucLevel = ( unsigned char ) ( ( ulOn * dispLEVELS + dispSLOT_US / 2 ) / dispSLOT_US );
+				if( ucLevel < 1 ) ucLevel = 1;
+				if( ucLevel > dispLEVELS ) ucLevel = dispLEVELS;
+				xFrame.ucLevel[ iLit ] = ucLevel;
+
+				/* Frames start with digit 0, earlier slots are dropped. */
+				if( iLit == iNext )
+				{
+					iNext++;
+					if( iNext == dispDIGITS )
+					{
+						prvAddFrame( &xFrame, ulTime );
+						iNext = 0;
+					}
+				}
+				else
+				{
+					iNext = ( iLit == 0 ) ? 1 : 0;
+				}
+				iLit = -1;
+			}
+
+			for( i = 0; i < dispDIGITS; i++ )
+			{
+				if( ( uiValue & ( 1U << i ) ) == 0 )
+				{
+					iLit = i;
+					ulLitSince = ulTime;
+					xFrame.ucSeg[ i ] = ucSegments;
+					break;
+				}
+			}
+		}
+	}
+
+	fclose( pxFile );
+
+	prvPrintScreens();
+
+	return ( ulTornFrames == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
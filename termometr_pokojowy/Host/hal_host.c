@@ -0,0 +1,410 @@
+/*
+ * hal_host.c
+ *
+ * Host backend of hal.h, see hal_host.h.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <avr/interrupt.h>
+
+#include "FreeRTOS.h"
+
+#include "avrsim.h"
+#include "owsim.h"
+#include "hal.h"
+#include "onewire.h"
+
+/* Key timeline replayed on KEYS_PIN. */
+typedef struct xHAL_KEY_EVENT
+{
+	uint32_t ulTimeMs;
+	uint8_t ucPressed;
+} xHalKeyEvent;
+
+static xHalTraceEntry xTrace[ halhostTRACE_LENGTH ];
+static uint32_t ulTraceWrites;
+
+static xHalKeyEvent *pxKeyEvents;
+static size_t xNumKeyEvents;
+
+static xHalRefreshStats xRefresh;
+static uint32_t ulLastSwitchUs;
+static uint32_t ulFirstSwitchUs;
+static int8_t cLitDigit = -1;
+static uint32_t ulLitSinceUs;
+
+/* Key press to LED response: the scripted presses not yet seen, the press
+waiting for the LED port to change and the latencies measured so far. */
+static size_t xKeyScan;
+static uint8_t ucKeysScanned;
+static uint32_t ulPendingPressUs;
+static uint8_t ucPressPending;
+static uint8_t ucLastLeds;
+static uint32_t ulPressesAnswered, ulPressesMissed;
+static uint32_t ulMinLatencyUs, ulMaxLatencyUs;
+static uint64_t ullSumLatencyUs;
+
+static const char *pcTraceFile;
+static uint32_t ulRunUs;
+
+static void prvHalHostInit( void ) __attribute__ ( ( constructor ) );
+/*-----------------------------------------------------------*/
+
+static int8_t prvPortIndex( volatile uint8_t *pucRegister )
+{
+	if( pucRegister == &PORTA ) return avrsimPORTA;
+	if( pucRegister == &PORTB ) return avrsimPORTB;
+	if( pucRegister == &PORTC ) return avrsimPORTC;
+	if( pucRegister == &PORTD ) return avrsimPORTD;
+	return -1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUpdateRefresh( uint32_t ulNow, uint8_t ucDigits )
+{
+uint32_t ulPeriod;
+uint8_t ucSelected;
+int8_t cDigit;
+
+	/* The on-time of a digit lasts until the next write to the digit
+	select port, whether it switches to another digit or blanks them all. */
+	if( cLitDigit >= 0 )
+	{
+		xRefresh.ullOnUs[ cLitDigit ] += ulNow - ulLitSinceUs;
+	}
+	if( xRefresh.ulSwitches != 0 )
+	{
+		xRefresh.ullSpanUs = ulNow - ulFirstSwitchUs;
+	}
+
+	/* Active low select lines, one digit at a time. */
+	cLitDigit = -1;
+	ucSelected = ( uint8_t ) ( ~ucDigits & LED_DIGITS_MASK );
+	for( cDigit = 0; cDigit < NUMBER_OF_DIGITS; cDigit++ )
+	{
+		if( ucSelected == ( 1U << cDigit ) )
+		{
+			cLitDigit = cDigit;
+			ulLitSinceUs = ulNow;
+		}
+	}
+
+	/* Only the writes which turn a digit on mark a display slot. */
+	if( ucSelected == 0 )
+	{
+		return;
+	}
+
+	if( xRefresh.ulSwitches != 0 )
+	{
+		ulPeriod = ulNow - ulLastSwitchUs;
+		if( ( xRefresh.ulSwitches == 1 ) || ( ulPeriod < xRefresh.ulMinPeriodUs ) )
+		{
+			xRefresh.ulMinPeriodUs = ulPeriod;
+		}
+		if( ulPeriod > xRefresh.ulMaxPeriodUs )
+		{
+			xRefresh.ulMaxPeriodUs = ulPeriod;
+		}
+		xRefresh.ullSumPeriodUs += ulPeriod;
+		xRefresh.ullSumSquaresUs += ( uint64_t ) ulPeriod * ulPeriod;
+	}
+
+	else
+	{
+		ulFirstSwitchUs = ulNow;
+	}
+
+	xRefresh.ulSwitches++;
+	ulLastSwitchUs = ulNow;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Time from a scripted key press to the next change of the mode LEDs, which
+ * the keys/LED task writes in the same pass as the display frame.  A press
+ * followed by another one before any LED change (a key without a visible
+ * effect) is counted as missed.
+ */
+static void prvUpdateKeyLatency( uint32_t ulNow, uint8_t ucLeds )
+{
+uint32_t ulLatency;
+
+	while( ( xKeyScan < xNumKeyEvents ) && ( pxKeyEvents[ xKeyScan ].ulTimeMs * 1000UL <= ulNow ) )
+	{
+		if( ( pxKeyEvents[ xKeyScan ].ucPressed & ( uint8_t ) ~ucKeysScanned ) != 0 )
+		{
+			if( ucPressPending != 0 )
+			{
+				ulPressesMissed++;
+			}
+			ulPendingPressUs = pxKeyEvents[ xKeyScan ].ulTimeMs * 1000UL;
+			ucPressPending = 1;
+		}
+		ucKeysScanned = pxKeyEvents[ xKeyScan ].ucPressed;
+		xKeyScan++;
+	}
+
+	if( ( ucPressPending != 0 ) && ( ucLeds != ucLastLeds ) )
+	{
+		ulLatency = ulNow - ulPendingPressUs;
+		if( ( ulPressesAnswered == 0 ) || ( ulLatency < ulMinLatencyUs ) )
+		{
+			ulMinLatencyUs = ulLatency;
+		}
+		if( ulLatency > ulMaxLatencyUs )
+		{
+			ulMaxLatencyUs = ulLatency;
+		}
+		ullSumLatencyUs += ulLatency;
+		ulPressesAnswered++;
+		ucPressPending = 0;
+	}
+
+	ucLastLeds = ucLeds;
+}
+/*-----------------------------------------------------------*/
+
+void vHalHostOut( volatile uint8_t *pucRegister, uint8_t ucValue )
+{
+uint8_t ucSREG = SREG;
+uint32_t ulNow;
+int8_t cPort;
+
+	/* The register write and its trace entry form one step, an interrupt
+	writing a port in between would reorder the trace. */
+	cli();
+
+	*pucRegister = ucValue;
+
+	if( ( pucRegister == &OW_DDR ) || ( pucRegister == &OW_OUT ) )
+	{
+		vOwSimPortWritten();
+	}
+	else if( ( pucRegister == &UDR ) && ( ( UCSRB & _BV( TXEN ) ) != 0 ) )
+	{
+		/* The USART transmits onto the 1-Wire bus (OW_BACKEND_UART). */
+		vAvrSimUsartTransmit( ucOwSimUartFrame( ucValue, ulAvrSimUsartBitNs() ) );
+	}
+
+	cPort = prvPortIndex( pucRegister );
+	if( cPort >= 0 )
+	{
+		ulNow = ulAvrSimMicros();
+
+		xTrace[ ulTraceWrites % halhostTRACE_LENGTH ].ulTimeUs = ulNow;
+		xTrace[ ulTraceWrites % halhostTRACE_LENGTH ].ucPort = ( uint8_t ) cPort;
+		xTrace[ ulTraceWrites % halhostTRACE_LENGTH ].ucValue = ucValue;
+		ulTraceWrites++;
+
+		if( pucRegister == &LED_digits )
+		{
+			prvUpdateRefresh( ulNow, ucValue );
+		}
+		else if( pucRegister == &LED_PORT )
+		{
+			prvUpdateKeyLatency( ulNow, ucValue );
+		}
+
+		if( ( ulRunUs != 0 ) && ( ulNow >= ulRunUs ) )
+		{
+			vHalHostFinish();
+		}
+	}
+
+	if( ( ucSREG & avrsimSREG_I ) != 0 )
+	{
+		sei();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHalHostTimer2Start( uint8_t ucCounts )
+{
+	vAvrSimSyncTimers();
+	OCR2 = ucCounts;
+	TCNT2 = 0;
+	TIFR &= ( uint8_t ) ~_BV( OCF2 );
+	vAvrSimTimersWritten();
+}
+/*-----------------------------------------------------------*/
+
+/* The keys and the 1-Wire slaves share PORTD. */
+static uint8_t prvPortDSource( void )
+{
+uint32_t ulNowMs = ulAvrSimMicros() / 1000UL;
+uint8_t ucPressed = 0;
+size_t x;
+
+	for( x = 0; ( x < xNumKeyEvents ) && ( pxKeyEvents[ x ].ulTimeMs <= ulNowMs ); x++ )
+	{
+		ucPressed = pxKeyEvents[ x ].ucPressed;
+	}
+
+	return ( uint8_t ) ( ( ucPressed & KEYS_MASK ) | ucOwSimPinsLow() );
+}
+/*-----------------------------------------------------------*/
+
+static void prvLoadKeys( const char *pcFile )
+{
+FILE *pxFile;
+char cLine[ 128 ];
+unsigned long ulTime;
+long lMask;
+
+	pxFile = fopen( pcFile, "r" );
+	if( pxFile == NULL )
+	{
+		perror( pcFile );
+		exit( EXIT_FAILURE );
+	}
+
+	while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+	{
+		if( sscanf( cLine, "%lu %li", &ulTime, &lMask ) != 2 )
+		{
+			/* Comment or empty line. */
+			continue;
+		}
+
+		pxKeyEvents = realloc( pxKeyEvents, ( xNumKeyEvents + 1 ) * sizeof( xHalKeyEvent ) );
+		if( pxKeyEvents == NULL )
+		{
+			abort();
+		}
+		pxKeyEvents[ xNumKeyEvents ].ulTimeMs = ( uint32_t ) ulTime;
+		pxKeyEvents[ xNumKeyEvents ].ucPressed = ( uint8_t ) lMask;
+		xNumKeyEvents++;
+	}
+
+	fclose( pxFile );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHalHostInit( void )
+{
+const char *pcValue;
+
+	pcValue = getenv( "TERMOMETR_KEYS" );
+	if( pcValue != NULL )
+	{
+		prvLoadKeys( pcValue );
+	}
+
+	vAvrSimSetPinSource( avrsimPORTD, prvPortDSource );
+
+	pcTraceFile = getenv( "TERMOMETR_TRACE" );
+
+	pcValue = getenv( "TERMOMETR_RUN_MS" );
+	if( pcValue != NULL )
+	{
+		ulRunUs = ( uint32_t ) strtoul( pcValue, NULL, 0 ) * 1000UL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHalHostGetRefreshStats( xHalRefreshStats *pxStats )
+{
+uint8_t ucSREG = SREG;
+
+	cli();
+	*pxStats = xRefresh;
+	if( ( ucSREG & avrsimSREG_I ) != 0 )
+	{
+		sei();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHalHostFinish( void )
+{
+FILE *pxFile;
+uint32_t ulFirst, ul;
+xHalRefreshStats xStats;
+double dMean, dDeviation;
+xHalTraceEntry *pxEntry;
+xOwSimStats xBus;
+uint32_t ulNow;
+int iDigit;
+
+	cli();
+
+	if( pcTraceFile != NULL )
+	{
+		pxFile = fopen( pcTraceFile, "w" );
+		if( pxFile != NULL )
+		{
+			ulFirst = ( ulTraceWrites > halhostTRACE_LENGTH ) ? ( ulTraceWrites - halhostTRACE_LENGTH ) : 0;
+			for( ul = ulFirst; ul < ulTraceWrites; ul++ )
+			{
+				pxEntry = &xTrace[ ul % halhostTRACE_LENGTH ];
+				fprintf( pxFile, "%lu,%c,0x%02x\n", ( unsigned long ) pxEntry->ulTimeUs, 'A' + pxEntry->ucPort, pxEntry->ucValue );
+			}
+			fclose( pxFile );
+		}
+		else
+		{
+			perror( pcTraceFile );
+		}
+	}
+
+	xStats = xRefresh;
+	if( xStats.ulSwitches > 1 )
+	{
+		dMean = ( double ) xStats.ullSumPeriodUs / ( xStats.ulSwitches - 1 );
+		dDeviation = sqrt( ( double ) xStats.ullSumSquaresUs / ( xStats.ulSwitches - 1 ) - dMean * dMean );
+		fprintf( stderr, "display: %lu digit switches, period min %lu us, mean %.1f us, max %lu us, std dev %.1f us\n",
+				 ( unsigned long ) xStats.ulSwitches, ( unsigned long ) xStats.ulMinPeriodUs, dMean,
+				 ( unsigned long ) xStats.ulMaxPeriodUs, dDeviation );
+		if( xStats.ullSpanUs != 0ULL )
+		{
+			fprintf( stderr, "display: digit duty" );
+			for( iDigit = 0; iDigit < NUMBER_OF_DIGITS; iDigit++ )
+			{
+				fprintf( stderr, " %d: %.1f%%", iDigit, 100.0 * ( double ) xStats.ullOnUs[ iDigit ] / ( double ) xStats.ullSpanUs );
+			}
+			fprintf( stderr, "\n" );
+		}
+	}
+	else
+	{
+		fprintf( stderr, "display: not refreshed\n" );
+	}
+
+	if( ulPressesAnswered != 0 )
+	{
+		fprintf( stderr, "keys: %lu presses answered (%lu without LED change), latency min %lu us, mean %.1f us, max %lu us\n",
+				 ( unsigned long ) ulPressesAnswered, ( unsigned long ) ulPressesMissed, ( unsigned long ) ulMinLatencyUs,
+				 ( double ) ullSumLatencyUs / ulPressesAnswered, ( unsigned long ) ulMaxLatencyUs );
+	}
+
+	vOwSimGetStats( &xBus );
+	fprintf( stderr, "onewire: %lu resets (%lu answered), %lu slots, %lu us bus time, %lu conversions (%lu failed), %lu scratchpad reads (%lu corrupted)\n",
+			 ( unsigned long ) xBus.ulResets, ( unsigned long ) xBus.ulPresences, ( unsigned long ) xBus.ulSlots,
+			 ( unsigned long ) xBus.ulBusTimeUs, ( unsigned long ) xBus.ulConversions, ( unsigned long ) xBus.ulFailedConversions,
+			 ( unsigned long ) xBus.ulScratchpadReads, ( unsigned long ) xBus.ulCrcFaults );
+	if( xBus.ulConvertCommands > 1 )
+	{
+		dMean = ( double ) xBus.ullSumConvertIntervalUs / ( xBus.ulConvertCommands - 1 );
+		dDeviation = sqrt( ( double ) xBus.ullSumSquaresConvertUs / ( xBus.ulConvertCommands - 1 ) - dMean * dMean );
+		fprintf( stderr, "sampling: %lu convert commands, interval min %lu us, mean %.1f us, max %lu us, std dev %.1f us\n",
+				 ( unsigned long ) xBus.ulConvertCommands, ( unsigned long ) xBus.ulMinConvertIntervalUs, dMean,
+				 ( unsigned long ) xBus.ulMaxConvertIntervalUs, dDeviation );
+	}
+
+	/* Vector 7 is the tick (TIMER1_COMPA), 10 the display (TIMER0_COMP). */
+	ulNow = ulAvrSimMicros();
+	fprintf( stderr, "power: asleep %.1f%% of %lu ms (tickless idle %s), %lu tick interrupts (%.1f/s), %lu display interrupts\n",
+			 100.0 * ( double ) ulAvrSimSleepUs() / ( double ) ulNow, ( unsigned long ) ( ulNow / 1000UL ),
+			 ( configUSE_TICKLESS_IDLE == 1 ) ? "on" : "off", ( unsigned long ) ulAvrSimInterrupts( 7 ),
+			 1e6 * ( double ) ulAvrSimInterrupts( 7 ) / ( double ) ulNow, ( unsigned long ) ulAvrSimInterrupts( 10 ) );
+	#if ( configUSE_TICKLESS_IDLE == 1 )
+		fprintf( stderr, "power: %lu idle periods not stretched, the tick ended before the write\n", ulPortTicklessWindowHits() );
+	#endif
+
+	exit( EXIT_SUCCESS );
+}
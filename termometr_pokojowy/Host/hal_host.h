@@ -0,0 +1,59 @@
+/*
+ * hal_host.h
+ *
+ * Host backend of hal.h: the simulated thermometer board.
+ *
+ * Every write done through HAL_OUT() is applied to the simulated register and,
+ * for PORTA..PORTD, recorded with its time stamp.  The board is configured from
+ * the environment when the program starts:
+ *
+ *   TERMOMETR_KEYS=<file>    key timeline replayed on the key inputs, one
+ *                            "<time ms> <mask>" line per change, the mask has
+ *                            a bit set for each pressed key (KEY1 = 0x01)
+ *   TERMOMETR_TRACE=<file>   pin trace written at the end of the run, one
+ *                            "<time us>,<port>,<value>" line per write
+ *   TERMOMETR_RUN_MS=<ms>    stop after this much simulated time and print the
+ *                            display refresh, key response and 1-Wire bus
+ *                            statistics to stderr
+ *   TERMOMETR_OW=<file>      1-Wire slaves and bus faults, see owsim.h
+ */
+
+#ifndef HAL_HOST_H_
+#define HAL_HOST_H_
+
+#include <inttypes.h>
+
+/* Number of writes kept in the trace, older ones are overwritten. */
+#define halhostTRACE_LENGTH		65536UL
+
+typedef struct xHAL_TRACE_ENTRY
+{
+	uint32_t ulTimeUs;
+	uint8_t ucPort;				/*< avrsimPORTA ... avrsimPORTD. */
+	uint8_t ucValue;
+} xHalTraceEntry;
+
+/* Statistics of the display multiplexing, from the digit select writes. */
+typedef struct xHAL_REFRESH_STATS
+{
+	uint32_t ulSwitches;		/*< Digit switches seen. */
+	uint32_t ulMinPeriodUs;
+	uint32_t ulMaxPeriodUs;
+	uint64_t ullSumPeriodUs;
+	uint64_t ullSumSquaresUs;
+	uint64_t ullOnUs[ NUMBER_OF_DIGITS ];	/*< Time each digit was selected. */
+	uint64_t ullSpanUs;			/*< Time from the first digit switch on. */
+} xHalRefreshStats;
+
+void vHalHostOut( volatile uint8_t *pucRegister, uint8_t ucValue );
+
+/* HAL_TIMER2_START(): restart Timer2 counting towards ucCounts. */
+void vHalHostTimer2Start( uint8_t ucCounts );
+
+/* Copy of the refresh statistics gathered so far. */
+void vHalHostGetRefreshStats( xHalRefreshStats *pxStats );
+
+/* Write the trace and the refresh statistics and leave the program. */
+void vHalHostFinish( void );
+
+#endif /* HAL_HOST_H_ */
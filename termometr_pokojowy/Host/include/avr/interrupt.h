@@ -0,0 +1,18 @@
+/*
+ * avr/interrupt.h
+ *
+ * Host replacement of the avr-libc header.  cli()/sei() operate on the I bit
+ * of the simulated SREG, ISR() defines the vector the simulator dispatches.
+ */
+
+#ifndef AVRSIM_INTERRUPT_H_
+#define AVRSIM_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define cli()		( SREG &= ( uint8_t ) ~avrsimSREG_I )
+#define sei()		do { SREG |= avrsimSREG_I; vAvrSimInterruptsEnabled(); } while( 0 )
+
+#define ISR( vector, ... )	void vector( void ); void vector( void )
+
+#endif /* AVRSIM_INTERRUPT_H_ */
@@ -0,0 +1,188 @@
+/*
+ * avr/io.h
+ *
+ * Host replacement of the avr-libc header for the ATmega32.  Registers are
+ * variables of the simulated MCU (Host/avrsim.c), PINx are computed on every
+ * read from PORTx/DDRx and the devices attached to the pins.
+ */
+
+#ifndef AVRSIM_IO_H_
+#define AVRSIM_IO_H_
+
+#include <inttypes.h>
+
+#include "avrsim.h"
+
+#define _BV( bit )						( 1 << ( bit ) )
+#define bit_is_set( sfr, bit )			( ( sfr ) & _BV( bit ) )
+#define bit_is_clear( sfr, bit )		( !( ( sfr ) & _BV( bit ) ) )
+#define loop_until_bit_is_set( sfr, bit )	do { } while( bit_is_clear( sfr, bit ) )
+#define loop_until_bit_is_clear( sfr, bit )	do { } while( bit_is_set( sfr, bit ) )
+
+/* Status register. */
+extern volatile uint8_t SREG;
+
+/* I/O ports. */
+extern volatile uint8_t PORTA, DDRA;
+extern volatile uint8_t PORTB, DDRB;
+extern volatile uint8_t PORTC, DDRC;
+extern volatile uint8_t PORTD, DDRD;
+
+#define PINA	( ucAvrSimReadPin( avrsimPORTA ) )
+#define PINB	( ucAvrSimReadPin( avrsimPORTB ) )
+#define PINC	( ucAvrSimReadPin( avrsimPORTC ) )
+#define PIND	( ucAvrSimReadPin( avrsimPORTD ) )
+
+/* Timer interrupt mask and flag registers. */
+extern volatile uint8_t TIMSK, TIFR;
+
+#define TOIE0	0
+#define OCIE0	1
+#define TOIE1	2
+#define OCIE1B	3
+#define OCIE1A	4
+#define TICIE1	5
+#define TOIE2	6
+#define OCIE2	7
+
+#define TOV0	0
+#define OCF0	1
+#define TOV1	2
+#define OCF1B	3
+#define OCF1A	4
+#define ICF1	5
+#define TOV2	6
+#define OCF2	7
+
+/* Timer/Counter0. */
+extern volatile uint8_t TCCR0, TCNT0, OCR0;
+
+#define CS00	0
+#define CS01	1
+#define CS02	2
+#define WGM01	3
+#define COM00	4
+#define COM01	5
+#define WGM00	6
+#define FOC0	7
+
+/* Timer/Counter2. */
+extern volatile uint8_t TCCR2, TCNT2, OCR2;
+
+#define CS20	0
+#define CS21	1
+#define CS22	2
+#define WGM21	3
+#define COM20	4
+#define COM21	5
+#define WGM20	6
+#define FOC2	7
+
+/* Timer/Counter1. */
+extern volatile uint8_t TCCR1A, TCCR1B;
+extern volatile uint16_t TCNT1, OCR1A, OCR1B, ICR1;
+
+#define TCNT1L	( ( ( volatile uint8_t * ) &TCNT1 )[ 0 ] )
+#define TCNT1H	( ( ( volatile uint8_t * ) &TCNT1 )[ 1 ] )
+#define OCR1AL	( ( ( volatile uint8_t * ) &OCR1A )[ 0 ] )
+#define OCR1AH	( ( ( volatile uint8_t * ) &OCR1A )[ 1 ] )
+#define OCR1BL	( ( ( volatile uint8_t * ) &OCR1B )[ 0 ] )
+#define OCR1BH	( ( ( volatile uint8_t * ) &OCR1B )[ 1 ] )
+
+#define WGM10	0
+#define WGM11	1
+#define CS10	0
+#define CS11	1
+#define CS12	2
+#define WGM12	3
+#define WGM13	4
+#define ICES1	6
+#define ICNC1	7
+
+/* USART.  UDR holds the last received frame, transmitting is done by writing
+it through HAL_OUT() (see Host/hal_host.c).  UBRRH and UCSRC share an address
+on the chip, here they are separate registers. */
+extern volatile uint8_t UDR, UCSRA, UCSRB, UCSRC, UBRRH, UBRRL;
+
+#define MPCM	0
+#define U2X		1
+#define PE		2
+#define DOR		3
+#define FE		4
+#define UDRE	5
+#define TXC		6
+#define RXC		7
+
+#define TXB8	0
+#define RXB8	1
+#define UCSZ2	2
+#define TXEN	3
+#define RXEN	4
+#define UDRIE	5
+#define TXCIE	6
+#define RXCIE	7
+
+#define UCPOL	0
+#define UCSZ0	1
+#define UCSZ1	2
+#define USBS	3
+#define UPM0	4
+#define UPM1	5
+#define UMSEL	6
+#define URSEL	7
+
+/* Port pin numbers. */
+#define PA0	0
+#define PA1	1
+#define PA2	2
+#define PA3	3
+#define PA4	4
+#define PA5	5
+#define PA6	6
+#define PA7	7
+
+#define PB0	0
+#define PB1	1
+#define PB2	2
+#define PB3	3
+#define PB4	4
+#define PB5	5
+#define PB6	6
+#define PB7	7
+
+#define PC0	0
+#define PC1	1
+#define PC2	2
+#define PC3	3
+#define PC4	4
+#define PC5	5
+#define PC6	6
+#define PC7	7
+
+#define PD0	0
+#define PD1	1
+#define PD2	2
+#define PD3	3
+#define PD4	4
+#define PD5	5
+#define PD6	6
+#define PD7	7
+
+/* Interrupt vectors, numbered as in the ATmega32 datasheet. */
+#define INT0_vect			__vector_1
+#define INT1_vect			__vector_2
+#define INT2_vect			__vector_3
+#define TIMER2_COMP_vect	__vector_4
+#define TIMER2_OVF_vect		__vector_5
+#define TIMER1_CAPT_vect	__vector_6
+#define TIMER1_COMPA_vect	__vector_7
+#define TIMER1_COMPB_vect	__vector_8
+#define TIMER1_OVF_vect		__vector_9
+#define TIMER0_COMP_vect	__vector_10
+#define TIMER0_OVF_vect		__vector_11
+#define SPI_STC_vect		__vector_12
+#define USART_RXC_vect		__vector_13
+#define USART_UDRE_vect		__vector_14
+#define USART_TXC_vect		__vector_15
+
+#endif /* AVRSIM_IO_H_ */
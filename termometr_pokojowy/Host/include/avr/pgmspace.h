@@ -0,0 +1,19 @@
+/*
+ * avr/pgmspace.h
+ *
+ * Host replacement of the avr-libc header.  There is a single address space,
+ * so flash constants are ordinary const data.
+ */
+
+#ifndef AVRSIM_PGMSPACE_H_
+#define AVRSIM_PGMSPACE_H_
+
+#include <inttypes.h>
+
+#define PROGMEM
+#define PSTR( s )				( s )
+
+#define pgm_read_byte( addr )	( *( const uint8_t * ) ( addr ) )
+#define pgm_read_word( addr )	( *( const uint16_t * ) ( addr ) )
+
+#endif /* AVRSIM_PGMSPACE_H_ */
@@ -0,0 +1,23 @@
+/*
+ * avr/sleep.h
+ *
+ * Host replacement of the avr-libc header.  Only the idle mode is modelled:
+ * sleep_cpu() busy waits, so that the simulated timers keep running, until an
+ * interrupt has been taken.  An interrupt that became pending after
+ * sleep_enable() ends the sleep as well, as the instruction after sei is
+ * always executed first on the MCU.
+ */
+
+#ifndef AVRSIM_SLEEP_H_
+#define AVRSIM_SLEEP_H_
+
+#include "avrsim.h"
+
+#define SLEEP_MODE_IDLE			0
+
+#define set_sleep_mode( mode )	( ( void ) ( mode ) )
+#define sleep_enable()			vAvrSimSleepEnable()
+#define sleep_disable()			do { } while( 0 )
+#define sleep_cpu()				vAvrSimSleep()
+
+#endif /* AVRSIM_SLEEP_H_ */
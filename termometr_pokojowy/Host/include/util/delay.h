@@ -0,0 +1,16 @@
+/*
+ * util/delay.h
+ *
+ * Host replacement of the avr-libc header.  The delays busy wait on the host
+ * clock, so interrupts keep being taken exactly as they would on the MCU.
+ */
+
+#ifndef AVRSIM_DELAY_H_
+#define AVRSIM_DELAY_H_
+
+#include "avrsim.h"
+
+#define _delay_us( us )		vAvrSimDelayUs( ( double ) ( us ) )
+#define _delay_ms( ms )		vAvrSimDelayUs( ( double ) ( ms ) * 1000.0 )
+
+#endif /* AVRSIM_DELAY_H_ */
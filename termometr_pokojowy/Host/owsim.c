@@ -0,0 +1,1041 @@
+/*
+ * owsim.c
+ *
+ * Simulated 1-Wire bus with DS18B20/DS18S20 slaves, see owsim.h.
+ *
+ * The master is followed edge by edge.  A low pulse of owsimRESET_MIN_US or
+ * more is a reset, anything shorter a time slot: the slaves decide on the
+ * falling edge whether they pull the line low (a 0 they transmit, wired-AND
+ * of all selected slaves), on the release the master bit is taken from the
+ * pulse width and the protocol state machine advances.
+ */
+
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <avr/io.h>
+
+#include "avrsim.h"
+#include "owsim.h"
+#include "onewire.h"
+#include "ds18x20.h"
+#include "crc8.h"
+
+/* Bus timing, in microseconds.  The slaves sample a write slot late in the
+15..60 us window of the data sheet and answer a reset with the longest
+presence pulse, which leaves room for the signal delivery jitter of the host.
+A transmitted 0 is held at least
+owsimREAD_ZERO_HOLD_US and in any case until the master writes the port
+again after sampling, so a late sample still reads the right bit. */
+#define owsimRESET_MIN_US				450
+#define owsimWRITE_ZERO_MIN_US			45
+#define owsimPRESENCE_START_US			20
+#define owsimPRESENCE_END_US			260
+#define owsimREAD_ZERO_HOLD_US			45
+#define owsimRESET_RECOVERY_US			480
+#define owsimSLOT_US					60
+#define owsimSTRONG_PULLUP_GRACE_US		100
+
+#define owsimDEFAULT_CONVERSION_MS		750
+#define owsimMAX_TEMPERATURE_STEPS		64
+#define owsimMAX_SHORTS					16
+#define owsimMAX_DETACHES				16
+
+#define OW_READ_ROM						0x33
+
+#define owsimPIN_MASK					( ( uint8_t ) ( 1 << OW_PIN ) )
+
+typedef enum
+{
+	eOwIdle,				/* Waiting for a reset. */
+	eOwRomCommand,
+	eOwMatchRom,
+	eOwSearchRom,
+	eOwReadRom,
+	eOwFunctionCommand,
+	eOwConvert,				/* Read slots return the conversion status. */
+	eOwReadScratchpad,
+	eOwWriteScratchpad,
+	eOwReadPower,
+	eOwDone					/* Command complete, read slots return 1. */
+} eOwSimState;
+
+typedef struct xOWSIM_DEVICE
+{
+	uint8_t ucRom[ OW_ROMCODE_SIZE ];
+	uint8_t ucParasite;
+	uint8_t ucSelected;
+	uint8_t ucAttached;						/*< Answered the last reset. */
+	uint8_t ucScratchpad[ DS18X20_SP_SIZE ];
+	uint8_t ucEeprom[ 3 ];					/*< TH, TL, configuration. */
+	uint8_t ucTransmit[ DS18X20_SP_SIZE ];	/*< Scratchpad being read. */
+	double dCelsius;
+	uint8_t ucConverting;
+	uint8_t ucStrongPullupSeen;
+	uint8_t ucPowerFailed;
+	uint32_t ulConversionStartUs;
+	uint32_t ulConversionEndUs;
+} xOwSimDevice;
+
+typedef struct xOWSIM_TEMPERATURE_STEP
+{
+	int xDevice;
+	uint32_t ulTimeMs;
+	double dCelsius;
+} xOwSimTemperatureStep;
+
+typedef struct xOWSIM_SHORT
+{
+	uint32_t ulFromMs;
+	uint32_t ulToMs;
+} xOwSimShort;
+
+typedef struct xOWSIM_DETACH
+{
+	int xDevice;
+	uint32_t ulFromMs;
+	uint32_t ulToMs;
+} xOwSimDetach;
+
+static xOwSimDevice xDevices[ owsimMAX_DEVICES ];
+static int xNumDevices;
+
+static xOwSimTemperatureStep xSteps[ owsimMAX_TEMPERATURE_STEPS ];
+static int xNumSteps;
+
+static xOwSimShort xShorts[ owsimMAX_SHORTS ];
+static int xNumShorts;
+
+static xOwSimDetach xDetaches[ owsimMAX_DETACHES ];
+static int xNumDetaches;
+static uint8_t ucShortedManually;
+
+static uint32_t ulConversionMs = owsimDEFAULT_CONVERSION_MS;
+static uint32_t ulCrcFaultInterval;
+
+/* Bus state. */
+static eOwSimState eState = eOwIdle;
+static uint8_t ucMasterLow;
+static uint32_t ulFallUs;
+static uint32_t ulSlaveLowUntilUs;
+static uint8_t ucSlaveHold;				/*< 0 none, 1 master low, 2 master released. */
+static uint8_t ucPresence;
+static uint32_t ulPresenceFromUs, ulPresenceToUs;
+static uint16_t usBit;
+static uint8_t ucByte;
+static uint8_t ucSearchStep;
+
+static xOwSimStats xStats;
+static uint32_t ulLastConvertUs;
+
+static void prvOwSimInit( void ) __attribute__ ( ( constructor ) );
+/*-----------------------------------------------------------*/
+
+/* a is before b, correct across the wrap of the microsecond counter. */
+#define owsimBEFORE( a, b )		( ( int32_t ) ( ( a ) - ( b ) ) < 0 )
+
+static uint8_t prvRomBit( const xOwSimDevice *pxDevice, uint16_t usIndex )
+{
+	return ( pxDevice->ucRom[ usIndex >> 3 ] >> ( usIndex & 7 ) ) & 1;
+}
+/*-----------------------------------------------------------*/
+
+/* The CRC the way a slave generates it: a bit-serial shift register, the
+original crc8() loop.  The firmware uses the table of crc8.c, so every
+scratchpad and ROM code read from the simulated bus also checks one against
+the other. */
+static uint8_t prvSlaveCrcUpdate( uint8_t ucCrc, uint8_t ucData )
+{
+uint8_t ucBit, ucFeedback;
+
+	for( ucBit = 0; ucBit < 8; ucBit++ )
+	{
+		ucFeedback = ( ucCrc ^ ucData ) & 0x01;
+		ucCrc >>= 1;
+		if( ucFeedback != 0 )
+		{
+			ucCrc ^= 0x8C;		/* X^8+X^5+X^4+X^0, reflected. */
+		}
+		ucData >>= 1;
+	}
+
+	return ucCrc;
+}
+/*-----------------------------------------------------------*/
+
+static uint8_t prvSlaveCrc( const uint8_t *pucData, size_t xLength )
+{
+uint8_t ucCrc = CRC8INIT;
+
+	while( xLength-- > 0 )
+	{
+		ucCrc = prvSlaveCrcUpdate( ucCrc, *pucData++ );
+	}
+
+	return ucCrc;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUpdateCrc( uint8_t *pucScratchpad )
+{
+	pucScratchpad[ DS18X20_SP_SIZE - 1 ] = prvSlaveCrc( pucScratchpad, DS18X20_SP_SIZE - 1 );
+}
+/*-----------------------------------------------------------*/
+
+static double prvTemperatureAt( int xDevice, uint32_t ulTimeMs )
+{
+double dCelsius = xDevices[ xDevice ].dCelsius;
+uint32_t ulLatestMs = 0;
+int x;
+
+	for( x = 0; x < xNumSteps; x++ )
+	{
+		if( ( xSteps[ x ].xDevice == xDevice ) && ( xSteps[ x ].ulTimeMs <= ulTimeMs ) && ( xSteps[ x ].ulTimeMs >= ulLatestMs ) )
+		{
+			ulLatestMs = xSteps[ x ].ulTimeMs;
+			dCelsius = xSteps[ x ].dCelsius;
+		}
+	}
+
+	return dCelsius;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStoreTemperature( xOwSimDevice *pxDevice, double dCelsius )
+{
+int16_t sRaw, sWhole;
+int32_t lSixteenths;
+uint8_t ucResolution;
+
+	if( dCelsius < -55.0 ) dCelsius = -55.0;
+	if( dCelsius > 125.0 ) dCelsius = 125.0;
+	lSixteenths = ( int32_t ) floor( dCelsius * 16.0 );
+
+	if( pxDevice->ucRom[ 0 ] == DS18B20_ID )
+	{
+		/* The bits below the selected resolution are left out. */
+		ucResolution = ( pxDevice->ucScratchpad[ DS18B20_CONF_REG ] >> 5 ) & 3;
+		sRaw = ( int16_t ) ( lSixteenths & ~( ( 1L << ( 3 - ucResolution ) ) - 1 ) );
+		pxDevice->ucScratchpad[ 6 ] = 0x0C;
+	}
+	else
+	{
+		/* Half degrees in the register, the rest in COUNT_REMAIN:
+		T = TEMP_READ - 0.25 + ( COUNT_PER_C - COUNT_REMAIN ) / COUNT_PER_C. */
+		sWhole = ( int16_t ) floor( ( lSixteenths + 4 ) / 16.0 );
+		sRaw = ( int16_t ) ( sWhole * 2 );
+		pxDevice->ucScratchpad[ 6 ] = ( uint8_t ) ( sWhole * 16 + 12 - lSixteenths );
+		pxDevice->ucScratchpad[ 7 ] = 0x10;
+	}
+
+	pxDevice->ucScratchpad[ 0 ] = ( uint8_t ) sRaw;
+	pxDevice->ucScratchpad[ 1 ] = ( uint8_t ) ( ( uint16_t ) sRaw >> 8 );
+	prvUpdateCrc( pxDevice->ucScratchpad );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCompleteConversions( uint32_t ulNow )
+{
+xOwSimDevice *pxDevice;
+int x;
+
+	for( x = 0; x < xNumDevices; x++ )
+	{
+		pxDevice = &xDevices[ x ];
+		if( ( pxDevice->ucConverting != 0 ) && !owsimBEFORE( ulNow, pxDevice->ulConversionEndUs ) )
+		{
+			pxDevice->ucConverting = 0;
+
+			if( ( pxDevice->ucParasite != 0 ) && ( ( pxDevice->ucPowerFailed != 0 ) || ( pxDevice->ucStrongPullupSeen == 0 ) ) )
+			{
+				/* Not enough power, the scratchpad keeps its old value. */
+				xStats.ulFailedConversions++;
+			}
+			else
+			{
+				prvStoreTemperature( pxDevice, prvTemperatureAt( x, pxDevice->ulConversionStartUs / 1000UL ) );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckParasitePower( uint32_t ulNow, uint8_t ucStrongPullup )
+{
+xOwSimDevice *pxDevice;
+uint8_t ucLate;
+int x;
+
+	for( x = 0; x < xNumDevices; x++ )
+	{
+		pxDevice = &xDevices[ x ];
+		if( ( pxDevice->ucConverting == 0 ) || ( pxDevice->ucParasite == 0 ) )
+		{
+			continue;
+		}
+
+		ucLate = !owsimBEFORE( ulNow, pxDevice->ulConversionStartUs + owsimSTRONG_PULLUP_GRACE_US );
+		if( ucStrongPullup != 0 )
+		{
+			if( ( pxDevice->ucStrongPullupSeen == 0 ) && ( ucLate != 0 ) )
+			{
+				pxDevice->ucPowerFailed = 1;
+			}
+			pxDevice->ucStrongPullupSeen = 1;
+		}
+		else if( ucLate != 0 )
+		{
+			pxDevice->ucPowerFailed = 1;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint8_t prvShorted( uint32_t ulNow )
+{
+uint32_t ulNowMs = ulNow / 1000UL;
+int x;
+
+	if( ucShortedManually != 0 )
+	{
+		return 1;
+	}
+
+	for( x = 0; x < xNumShorts; x++ )
+	{
+		if( ( ulNowMs >= xShorts[ x ].ulFromMs ) && ( ulNowMs < xShorts[ x ].ulToMs ) )
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+/* Bit the selected slaves put on the bus in the slot starting now, 1 if
+none of them transmits. */
+static uint8_t prvTransmitBit( void )
+{
+uint8_t ucBit = 1;
+xOwSimDevice *pxDevice;
+int x;
+
+	for( x = 0; x < xNumDevices; x++ )
+	{
+		pxDevice = &xDevices[ x ];
+		if( pxDevice->ucSelected == 0 )
+		{
+			continue;
+		}
+
+		switch( eState )
+		{
+			case eOwSearchRom:
+				if( ucSearchStep == 0 )
+				{
+					ucBit &= prvRomBit( pxDevice, usBit );
+				}
+				else if( ucSearchStep == 1 )
+				{
+					ucBit &= prvRomBit( pxDevice, usBit ) ^ 1;
+				}
+				break;
+
+			case eOwReadRom:
+				ucBit &= prvRomBit( pxDevice, usBit );
+				break;
+
+			case eOwReadScratchpad:
+				ucBit &= ( pxDevice->ucTransmit[ usBit >> 3 ] >> ( usBit & 7 ) ) & 1;
+				break;
+
+			case eOwConvert:
+				if( ( pxDevice->ucConverting != 0 ) && ( pxDevice->ucParasite == 0 ) )
+				{
+					ucBit = 0;
+				}
+				break;
+
+			case eOwReadPower:
+				if( pxDevice->ucParasite != 0 )
+				{
+					ucBit = 0;
+				}
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	return ucBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSelectAll( void )
+{
+int x;
+
+	for( x = 0; x < xNumDevices; x++ )
+	{
+		xDevices[ x ].ucSelected = xDevices[ x ].ucAttached;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Connect or disconnect the slaves at a reset, returns the number of
+connected ones. */
+static int prvAttachDevices( uint32_t ulNow )
+{
+uint32_t ulNowMs = ulNow / 1000UL;
+int x, y, xAttached = 0;
+
+	for( x = 0; x < xNumDevices; x++ )
+	{
+		xDevices[ x ].ucAttached = 1;
+		for( y = 0; y < xNumDetaches; y++ )
+		{
+			if( ( xDetaches[ y ].xDevice == x ) && ( ulNowMs >= xDetaches[ y ].ulFromMs ) && ( ulNowMs < xDetaches[ y ].ulToMs ) )
+			{
+				xDevices[ x ].ucAttached = 0;
+			}
+		}
+		xAttached += xDevices[ x ].ucAttached;
+	}
+
+	return xAttached;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRomCommand( uint8_t ucCommand )
+{
+	prvSelectAll();
+	usBit = 0;
+	ucSearchStep = 0;
+
+	switch( ucCommand )
+	{
+		case OW_SKIP_ROM:	eState = eOwFunctionCommand;	break;
+		case OW_MATCH_ROM:	eState = eOwMatchRom;			break;
+		case OW_SEARCH_ROM:	eState = eOwSearchRom;			break;
+		case OW_READ_ROM:	eState = eOwReadRom;			break;
+		default:			eState = eOwDone;				break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCountConvert( uint32_t ulNow )
+{
+uint32_t ulInterval;
+
+	if( xStats.ulConvertCommands != 0 )
+	{
+		ulInterval = ulNow - ulLastConvertUs;
+		if( ( xStats.ulConvertCommands == 1 ) || ( ulInterval < xStats.ulMinConvertIntervalUs ) )
+		{
+			xStats.ulMinConvertIntervalUs = ulInterval;
+		}
+		if( ulInterval > xStats.ulMaxConvertIntervalUs )
+		{
+			xStats.ulMaxConvertIntervalUs = ulInterval;
+		}
+		xStats.ullSumConvertIntervalUs += ulInterval;
+		xStats.ullSumSquaresConvertUs += ( uint64_t ) ulInterval * ulInterval;
+	}
+
+	xStats.ulConvertCommands++;
+	ulLastConvertUs = ulNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFunctionCommand( uint8_t ucCommand, uint32_t ulNow )
+{
+xOwSimDevice *pxDevice;
+uint32_t ulTimeMs, ulFaultBit;
+int x;
+
+	usBit = 0;
+
+	switch( ucCommand )
+	{
+		case DS18X20_CONVERT_T:
+			prvCountConvert( ulNow );
+			for( x = 0; x < xNumDevices; x++ )
+			{
+				pxDevice = &xDevices[ x ];
+				if( pxDevice->ucSelected == 0 )
+				{
+					continue;
+				}
+
+				ulTimeMs = ulConversionMs;
+				if( pxDevice->ucRom[ 0 ] == DS18B20_ID )
+				{
+					ulTimeMs >>= 3 - ( ( pxDevice->ucScratchpad[ DS18B20_CONF_REG ] >> 5 ) & 3 );
+				}
+
+				pxDevice->ucConverting = 1;
+				pxDevice->ucStrongPullupSeen = 0;
+				pxDevice->ucPowerFailed = 0;
+				pxDevice->ulConversionStartUs = ulNow;
+				pxDevice->ulConversionEndUs = ulNow + ulTimeMs * 1000UL;
+				xStats.ulConversions++;
+			}
+			eState = eOwConvert;
+			break;
+
+		case DS18X20_READ:
+			for( x = 0; x < xNumDevices; x++ )
+			{
+				pxDevice = &xDevices[ x ];
+				if( pxDevice->ucSelected == 0 )
+				{
+					continue;
+				}
+
+				memcpy( pxDevice->ucTransmit, pxDevice->ucScratchpad, DS18X20_SP_SIZE );
+				xStats.ulScratchpadReads++;
+				if( ( ulCrcFaultInterval != 0 ) && ( ( xStats.ulScratchpadReads % ulCrcFaultInterval ) == 0 ) )
+				{
+					/* A different bit each time, the CRC byte included. */
+					ulFaultBit = xStats.ulCrcFaults % ( DS18X20_SP_SIZE * 8 );
+					pxDevice->ucTransmit[ ulFaultBit >> 3 ] ^= ( uint8_t ) ( 1 << ( ulFaultBit & 7 ) );
+					xStats.ulCrcFaults++;
+				}
+			}
+			eState = eOwReadScratchpad;
+			break;
+
+		case DS18X20_WRITE:
+			ucByte = 0;
+			eState = eOwWriteScratchpad;
+			break;
+
+		case DS18X20_EE_WRITE:
+			for( x = 0; x < xNumDevices; x++ )
+			{
+				if( xDevices[ x ].ucSelected != 0 )
+				{
+					memcpy( xDevices[ x ].ucEeprom, &xDevices[ x ].ucScratchpad[ 2 ], sizeof( xDevices[ x ].ucEeprom ) );
+				}
+			}
+			eState = eOwDone;
+			break;
+
+		case DS18X20_EE_RECALL:
+			for( x = 0; x < xNumDevices; x++ )
+			{
+				if( xDevices[ x ].ucSelected != 0 )
+				{
+					memcpy( &xDevices[ x ].ucScratchpad[ 2 ], xDevices[ x ].ucEeprom, sizeof( xDevices[ x ].ucEeprom ) );
+					prvUpdateCrc( xDevices[ x ].ucScratchpad );
+				}
+			}
+			eState = eOwDone;
+			break;
+
+		case DS18X20_READ_POWER_SUPPLY:
+			eState = eOwReadPower;
+			break;
+
+		default:
+			eState = eOwDone;
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteScratchpadByte( uint8_t ucIndex, uint8_t ucValue )
+{
+xOwSimDevice *pxDevice;
+int x;
+
+	for( x = 0; x < xNumDevices; x++ )
+	{
+		pxDevice = &xDevices[ x ];
+		if( pxDevice->ucSelected == 0 )
+		{
+			continue;
+		}
+
+		if( ucIndex < 2 )
+		{
+			/* TH, TL. */
+			pxDevice->ucScratchpad[ 2 + ucIndex ] = ucValue;
+		}
+		else if( pxDevice->ucRom[ 0 ] == DS18B20_ID )
+		{
+			/* Only the resolution bits of the configuration are writable. */
+			pxDevice->ucScratchpad[ DS18B20_CONF_REG ] = ( uint8_t ) ( ( ucValue & DS18B20_12_BIT ) | 0x1F );
+		}
+		prvUpdateCrc( pxDevice->ucScratchpad );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* The master completed a time slot writing ucBit (1 for read slots). */
+static void prvMasterBit( uint8_t ucBit, uint32_t ulNow )
+{
+int x;
+
+	switch( eState )
+	{
+		case eOwRomCommand:
+		case eOwFunctionCommand:
+		case eOwWriteScratchpad:
+			ucByte = ( uint8_t ) ( ( ucByte >> 1 ) | ( ucBit << 7 ) );
+			usBit++;
+			if( ( usBit & 7 ) != 0 )
+			{
+				break;
+			}
+
+			if( eState == eOwRomCommand )
+			{
+				prvRomCommand( ucByte );
+			}
+			else if( eState == eOwFunctionCommand )
+			{
+				prvFunctionCommand( ucByte, ulNow );
+			}
+			else
+			{
+				prvWriteScratchpadByte( ( uint8_t ) ( ( usBit >> 3 ) - 1 ), ucByte );
+				if( usBit == 24 )
+				{
+					eState = eOwDone;
+				}
+			}
+			break;
+
+		case eOwMatchRom:
+			for( x = 0; x < xNumDevices; x++ )
+			{
+				if( prvRomBit( &xDevices[ x ], usBit ) != ucBit )
+				{
+					xDevices[ x ].ucSelected = 0;
+				}
+			}
+			if( ++usBit == OW_ROMCODE_SIZE * 8 )
+			{
+				usBit = 0;
+				eState = eOwFunctionCommand;
+			}
+			break;
+
+		case eOwSearchRom:
+			if( ucSearchStep < 2 )
+			{
+				ucSearchStep++;
+				break;
+			}
+
+			/* Direction chosen by the master, the others drop out. */
+			ucSearchStep = 0;
+			for( x = 0; x < xNumDevices; x++ )
+			{
+				if( prvRomBit( &xDevices[ x ], usBit ) != ucBit )
+				{
+					xDevices[ x ].ucSelected = 0;
+				}
+			}
+			if( ++usBit == OW_ROMCODE_SIZE * 8 )
+			{
+				usBit = 0;
+				eState = eOwFunctionCommand;
+			}
+			break;
+
+		case eOwReadRom:
+			if( ++usBit == OW_ROMCODE_SIZE * 8 )
+			{
+				usBit = 0;
+				eState = eOwFunctionCommand;
+			}
+			break;
+
+		case eOwReadScratchpad:
+			if( ++usBit == DS18X20_SP_SIZE * 8 )
+			{
+				eState = eOwDone;
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Delivering the simulator signal costs the host tens of microseconds, enough
+to turn a write 1 slot into a write 0 one.  It is held off while a master
+running at task level holds the line low, so the slaves see the pulse width
+the driver produced.  A master in an interrupt handler (ow_engine.c) already
+runs with the signal blocked and times the slots with it. */
+static sigset_t xMaskBeforeHold;
+static uint8_t ucSignalHeld;
+
+static void prvHoldSimulatorSignal( uint8_t ucHold )
+{
+sigset_t xSignals;
+
+	if( ucHold != 0 )
+	{
+		sigemptyset( &xSignals );
+		sigaddset( &xSignals, SIGALRM );
+		sigprocmask( SIG_BLOCK, &xSignals, &xMaskBeforeHold );
+		ucSignalHeld = !sigismember( &xMaskBeforeHold, SIGALRM );
+	}
+	else if( ucSignalHeld != 0 )
+	{
+		ucSignalHeld = 0;
+		sigprocmask( SIG_SETMASK, &xMaskBeforeHold, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMasterFalling( uint32_t ulNow )
+{
+	prvHoldSimulatorSignal( 1 );
+	ucMasterLow = 1;
+	ulFallUs = ulNow;
+	ucSlaveHold = 0;
+
+	/* A reset starts the same way, holding the line for a while does not
+	disturb it. */
+	if( prvTransmitBit() == 0 )
+	{
+		ulSlaveLowUntilUs = ulNow + owsimREAD_ZERO_HOLD_US;
+		ucSlaveHold = 1;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMasterRelease( uint32_t ulNow )
+{
+uint32_t ulLowUs = ulNow - ulFallUs;
+int x;
+
+	ucMasterLow = 0;
+	prvHoldSimulatorSignal( 0 );
+
+	if( ulLowUs >= owsimRESET_MIN_US )
+	{
+		xStats.ulResets++;
+		xStats.ulBusTimeUs += ulLowUs + owsimRESET_RECOVERY_US;
+
+		for( x = 0; x < xNumDevices; x++ )
+		{
+			xDevices[ x ].ucSelected = 0;
+		}
+		eState = eOwRomCommand;
+		usBit = 0;
+		ucByte = 0;
+		ulSlaveLowUntilUs = ulNow;
+		ucSlaveHold = 0;
+
+		ucPresence = ( prvAttachDevices( ulNow ) != 0 ) && ( prvShorted( ulNow ) == 0 );
+		if( ucPresence != 0 )
+		{
+			ulPresenceFromUs = ulNow + owsimPRESENCE_START_US;
+			ulPresenceToUs = ulNow + owsimPRESENCE_END_US;
+			xStats.ulPresences++;
+		}
+	}
+	else
+	{
+		if( ucSlaveHold != 0 )
+		{
+			ucSlaveHold = 2;
+		}
+		xStats.ulSlots++;
+		xStats.ulBusTimeUs += ( ulLowUs > owsimSLOT_US ) ? ulLowUs : owsimSLOT_US;
+		prvMasterBit( ( ulLowUs < owsimWRITE_ZERO_MIN_US ) ? 1 : 0, ulNow );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimPortWritten( void )
+{
+uint32_t ulNow = ulAvrSimMicros();
+uint8_t ucOutput = ( OW_DDR & owsimPIN_MASK ) != 0;
+uint8_t ucHigh = ( OW_OUT & owsimPIN_MASK ) != 0;
+
+	prvCompleteConversions( ulNow );
+	prvCheckParasitePower( ulNow, ucOutput && ucHigh );
+
+	if( ( ucOutput && !ucHigh ) != ( ucMasterLow != 0 ) )
+	{
+		if( ucMasterLow == 0 )
+		{
+			prvMasterFalling( ulNow );
+		}
+		else
+		{
+			prvMasterRelease( ulNow );
+		}
+	}
+	else if( ucSlaveHold == 2 )
+	{
+		/* The master has sampled the slot. */
+		ucSlaveHold = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint8_t prvPinsLowAt( uint32_t ulNow )
+{
+	if( prvShorted( ulNow ) != 0 )
+	{
+		return owsimPIN_MASK;
+	}
+
+	if( ( ucSlaveHold != 0 ) || owsimBEFORE( ulNow, ulSlaveLowUntilUs ) )
+	{
+		return owsimPIN_MASK;
+	}
+
+	if( ( ucPresence != 0 ) && !owsimBEFORE( ulNow, ulPresenceFromUs ) && owsimBEFORE( ulNow, ulPresenceToUs ) )
+	{
+		return owsimPIN_MASK;
+	}
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+uint8_t ucOwSimPinsLow( void )
+{
+	return prvPinsLowAt( ulAvrSimMicros() );
+}
+/*-----------------------------------------------------------*/
+
+uint8_t ucOwSimUartFrame( uint8_t ucTransmitted, uint32_t ulBitNs )
+{
+uint32_t ulStart = ulAvrSimMicros();
+uint8_t ucLowBits = 1, ucReceived = 0, ucBit;
+
+	prvCompleteConversions( ulStart );
+	prvCheckParasitePower( ulStart, 0 );
+
+	/* The start bit and the zero bits after it form the low pulse. */
+	while( ( ucLowBits < 9 ) && ( ( ucTransmitted & ( 1 << ( ucLowBits - 1 ) ) ) == 0 ) )
+	{
+		ucLowBits++;
+	}
+
+	prvMasterFalling( ulStart );
+	prvMasterRelease( ulStart + ( uint32_t ) ( ( uint64_t ) ucLowBits * ulBitNs / 1000ULL ) );
+
+	/* A zero being read is held for its nominal time only, no port write
+	ends it. */
+	ucSlaveHold = 0;
+
+	/* The receiver samples each data bit in its middle, from the line the
+	transmitter and the slaves drive together. */
+	for( ucBit = 0; ucBit < 8; ucBit++ )
+	{
+		if( ( ( ucTransmitted & ( 1 << ucBit ) ) != 0 ) &&
+			( prvPinsLowAt( ulStart + ( uint32_t ) ( ( uint64_t ) ( 3 + 2 * ucBit ) * ulBitNs / 2000ULL ) ) == 0 ) )
+		{
+			ucReceived |= ( uint8_t ) ( 1 << ucBit );
+		}
+	}
+
+	return ucReceived;
+}
+
+
+int xOwSimAddDevice( uint8_t ucFamily, uint64_t ullSerial, double dCelsius, uint8_t ucParasite )
+{
+static const uint8_t ucPowerOnB20[ DS18X20_SP_SIZE ] = { 0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x00 };
+static const uint8_t ucPowerOnS20[ DS18X20_SP_SIZE ] = { 0xAA, 0x00, 0x4B, 0x46, 0xFF, 0xFF, 0x0C, 0x10, 0x00 };
+xOwSimDevice *pxDevice;
+int x;
+
+	if( xNumDevices == owsimMAX_DEVICES )
+	{
+		return -1;
+	}
+
+	pxDevice = &xDevices[ xNumDevices ];
+	memset( pxDevice, 0, sizeof( xOwSimDevice ) );
+
+	pxDevice->ucRom[ 0 ] = ucFamily;
+	for( x = 1; x < OW_ROMCODE_SIZE - 1; x++ )
+	{
+		pxDevice->ucRom[ x ] = ( uint8_t ) ullSerial;
+		ullSerial >>= 8;
+	}
+	pxDevice->ucRom[ OW_ROMCODE_SIZE - 1 ] = prvSlaveCrc( pxDevice->ucRom, OW_ROMCODE_SIZE - 1 );
+
+	/* Power-on state, 85 degrees until the first conversion. */
+	memcpy( pxDevice->ucScratchpad, ( ucFamily == DS18S20_ID ) ? ucPowerOnS20 : ucPowerOnB20, DS18X20_SP_SIZE );
+	prvUpdateCrc( pxDevice->ucScratchpad );
+	memcpy( pxDevice->ucEeprom, &pxDevice->ucScratchpad[ 2 ], sizeof( pxDevice->ucEeprom ) );
+
+	pxDevice->dCelsius = dCelsius;
+	pxDevice->ucParasite = ucParasite;
+
+	return xNumDevices++;
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimRemoveDevices( void )
+{
+	xNumDevices = 0;
+	xNumSteps = 0;
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimSetTemperature( int xDevice, double dCelsius )
+{
+	if( ( xDevice >= 0 ) && ( xDevice < xNumDevices ) )
+	{
+		xDevices[ xDevice ].dCelsius = dCelsius;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimSetConversionTime( uint32_t ulMs )
+{
+	ulConversionMs = ulMs;
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimSetCrcFaultInterval( uint32_t ulInterval )
+{
+	ulCrcFaultInterval = ulInterval;
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimSetShort( uint8_t ucShorted )
+{
+	ucShortedManually = ucShorted;
+}
+/*-----------------------------------------------------------*/
+
+void vOwSimGetStats( xOwSimStats *pxStats )
+{
+	*pxStats = xStats;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLoadConfiguration( const char *pcFile )
+{
+FILE *pxFile;
+char cLine[ 128 ], cOption[ 16 ];
+unsigned int uiFamily;
+unsigned long long ullSerial;
+unsigned long ulFirst, ulSecond;
+double dCelsius;
+int xDevice;
+
+	pxFile = fopen( pcFile, "r" );
+	if( pxFile == NULL )
+	{
+		perror( pcFile );
+		exit( EXIT_FAILURE );
+	}
+
+	while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+	{
+		cOption[ 0 ] = '\0';
+
+		if( sscanf( cLine, " device %x %llx %lf %15s", &uiFamily, &ullSerial, &dCelsius, cOption ) >= 3 )
+		{
+			if( xOwSimAddDevice( ( uint8_t ) uiFamily, ullSerial, dCelsius, strcmp( cOption, "parasite" ) == 0 ) < 0 )
+			{
+				fprintf( stderr, "%s: more than %d devices\n", pcFile, owsimMAX_DEVICES );
+			}
+		}
+		else if( sscanf( cLine, " temperature %d %lu %lf", &xDevice, &ulFirst, &dCelsius ) == 3 )
+		{
+			if( xNumSteps < owsimMAX_TEMPERATURE_STEPS )
+			{
+				xSteps[ xNumSteps ].xDevice = xDevice;
+				xSteps[ xNumSteps ].ulTimeMs = ( uint32_t ) ulFirst;
+				xSteps[ xNumSteps ].dCelsius = dCelsius;
+				xNumSteps++;
+			}
+		}
+		else if( sscanf( cLine, " conversion %lu", &ulFirst ) == 1 )
+		{
+			ulConversionMs = ( uint32_t ) ulFirst;
+		}
+		else if( sscanf( cLine, " crc %lu", &ulFirst ) == 1 )
+		{
+			ulCrcFaultInterval = ( uint32_t ) ulFirst;
+		}
+		else if( sscanf( cLine, " detach %d %lu %lu", &xDevice, &ulFirst, &ulSecond ) == 3 )
+		{
+			if( xNumDetaches < owsimMAX_DETACHES )
+			{
+				xDetaches[ xNumDetaches ].xDevice = xDevice;
+				xDetaches[ xNumDetaches ].ulFromMs = ( uint32_t ) ulFirst;
+				xDetaches[ xNumDetaches ].ulToMs = ( uint32_t ) ulSecond;
+				xNumDetaches++;
+			}
+		}
+		else if( sscanf( cLine, " short %lu %lu", &ulFirst, &ulSecond ) == 2 )
+		{
+			if( xNumShorts < owsimMAX_SHORTS )
+			{
+				xShorts[ xNumShorts ].ulFromMs = ( uint32_t ) ulFirst;
+				xShorts[ xNumShorts ].ulToMs = ( uint32_t ) ulSecond;
+				xNumShorts++;
+			}
+		}
+	}
+
+	fclose( pxFile );
+}
+/*-----------------------------------------------------------*/
+
+/* crc8_update() of the firmware against the slave CRC, for every CRC state
+and data byte, and crc8() on a block with its own CRC appended. */
+static void prvCheckCrc8( void )
+{
+uint16_t usCrc, usData;
+uint8_t ucBlock[ DS18X20_SP_SIZE ] = { 0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10 };
+
+	for( usCrc = 0; usCrc < 256; usCrc++ )
+	{
+		for( usData = 0; usData < 256; usData++ )
+		{
+			if( crc8_update( ( uint8_t ) usCrc, ( uint8_t ) usData ) != prvSlaveCrcUpdate( ( uint8_t ) usCrc, ( uint8_t ) usData ) )
+			{
+				fprintf( stderr, "owsim: crc8_update( 0x%02x, 0x%02x ) differs from the bit-serial CRC\n", usCrc, usData );
+				abort();
+			}
+		}
+	}
+
+	ucBlock[ DS18X20_SP_SIZE - 1 ] = prvSlaveCrc( ucBlock, DS18X20_SP_SIZE - 1 );
+	if( crc8( ucBlock, DS18X20_SP_SIZE ) != 0 )
+	{
+		fprintf( stderr, "owsim: crc8() rejects a correct scratchpad\n" );
+		abort();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvOwSimInit( void )
+{
+const char *pcFile = getenv( "TERMOMETR_OW" );
+
+	prvCheckCrc8();
+
+	if( pcFile != NULL )
+	{
+		prvLoadConfiguration( pcFile );
+	}
+	else
+	{
+		xOwSimAddDevice( DS18B20_ID, 0x000001A2B3C4ULL, 21.5, 0 );
+	}
+}
@@ -0,0 +1,91 @@
+/*
+ * owsim.h
+ *
+ * Simulated 1-Wire bus of the host build: the slaves connected to OW_PIN.
+ *
+ * The model follows the master from the edges it produces through HAL_OUT()
+ * on OW_DDR/OW_OUT and answers on the pin read back from OW_IN, so onewire.c
+ * runs unchanged with its real timing.  With the USART transport the frames
+ * written to UDR are turned into the same pulses.  It implements the ROM layer (search,
+ * match, skip and read ROM) and the DS18B20/DS18S20 function commands
+ * (convert, read/write scratchpad, copy/recall EEPROM, read power supply).
+ *
+ * The bus is configured from the file named by TERMOMETR_OW, one item per
+ * line, '#' starts a comment:
+ *
+ *   device <family> <serial> <celsius> [parasite]
+ *                            slave with the given family code (28 or 10, hex)
+ *                            and 48-bit serial number (hex)
+ *   temperature <device> <time ms> <celsius>
+ *                            temperature of the device (0 = first one) from
+ *                            the given time on
+ *   conversion <ms>          12-bit conversion time, 750 by default
+ *   crc <n>                  corrupt one bit of every n-th scratchpad read
+ *   short <from ms> <to ms>  bus shorted to ground in this time window
+ *   detach <device> <from ms> <to ms>
+ *                            device disconnected in this time window, from
+ *                            the first reset in it to the first one after
+ *
+ * Without TERMOMETR_OW the bus has a single DS18B20 at 21.5 degrees.
+ *
+ * The bus runs on the simulated (thread CPU) time, but a heavily loaded host
+ * may still stretch a slot now and then; the driver then sees it as it would
+ * on a noisy bus, as a CRC or presence error.
+ */
+
+#ifndef OWSIM_H_
+#define OWSIM_H_
+
+#include <inttypes.h>
+
+#define owsimMAX_DEVICES		8
+
+/* Bus activity, for counting the cost of the driver operations. */
+typedef struct xOWSIM_STATS
+{
+	uint32_t ulResets;				/*< Reset pulses. */
+	uint32_t ulPresences;			/*< Resets answered with a presence pulse. */
+	uint32_t ulSlots;				/*< Read and write time slots. */
+	uint32_t ulBusTimeUs;			/*< Time taken by the resets and slots. */
+	uint32_t ulConversions;
+	uint32_t ulScratchpadReads;
+	uint32_t ulCrcFaults;			/*< Scratchpad reads corrupted on purpose. */
+	uint32_t ulFailedConversions;	/*< Parasite conversions without strong pull-up. */
+	uint32_t ulConvertCommands;		/*< Convert T commands, one per sample whatever the device count. */
+	uint32_t ulMinConvertIntervalUs;	/*< Spacing of the Convert T commands - the sampling period. */
+	uint32_t ulMaxConvertIntervalUs;
+	uint64_t ullSumConvertIntervalUs;
+	uint64_t ullSumSquaresConvertUs;
+} xOwSimStats;
+
+/* Connect a slave, returns its index or -1 if the bus is full. */
+int xOwSimAddDevice( uint8_t ucFamily, uint64_t ullSerial, double dCelsius, uint8_t ucParasite );
+
+/* Remove all slaves. */
+void vOwSimRemoveDevices( void );
+
+void vOwSimSetTemperature( int xDevice, double dCelsius );
+
+/* Conversion time of a 12-bit DS18B20 and of a DS18S20. */
+void vOwSimSetConversionTime( uint32_t ulMs );
+
+/* Corrupt every n-th scratchpad read, 0 disables. */
+void vOwSimSetCrcFaultInterval( uint32_t ulInterval );
+
+/* Hold the bus low (a short to ground) while ucShorted is non zero. */
+void vOwSimSetShort( uint8_t ucShorted );
+
+void vOwSimGetStats( xOwSimStats *pxStats );
+
+/* Hooks used by hal_host.c: the master wrote OW_DDR or OW_OUT, and the pins
+of the port the slaves currently pull low. */
+void vOwSimPortWritten( void );
+uint8_t ucOwSimPinsLow( void );
+
+/* Hook for the USART transport (OW_BACKEND_UART): one frame with the given
+bit time was sent onto the bus, returns the byte received meanwhile.  Only
+the low pulse at the start of the frame reaches the slaves, which is all the
+transport produces (0xF0 reset, 0x00 write 0, 0xFF write 1 or read). */
+uint8_t ucOwSimUartFrame( uint8_t ucTransmitted, uint32_t ulBitNs );
+
+#endif /* OWSIM_H_ */
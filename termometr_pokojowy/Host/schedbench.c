@@ -0,0 +1,156 @@
+/*
+ * schedbench.c
+ *
+ * Host micro-benchmark of the task selection in vTaskSwitchContext() ("make
+ * bench"), for comparing configMAX_PRIORITIES and configUSE_READY_BITMAP.
+ *
+ * tasks.c is included, not linked, so the benchmark can set the state the
+ * scheduler leaves behind when a task of the highest priority blocks: only
+ * tasks of the two lowest priorities are ready, but uxTopReadyPriority still
+ * names the highest one.  Without the bitmap the next selection scans the
+ * ready lists down from there, with it the top ready priority is looked up.
+ * Every selection starts from that state again; the selections are timed in a
+ * loop with the scheduler not started, so nothing else runs in between.  The
+ * same loop with uxTopReadyPriority left alone - the steady state when no task
+ * above priority 1 ever runs - is timed for reference.
+ *
+ * The port functions the kernel needs are stubs here: a task is never
+ * switched to, only selected.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../Source/tasks.c"
+
+/* Selections per timed loop, and the loops run; the fastest loop counts. */
+#define benchSELECTIONS			1000000UL
+#define benchRUNS				5
+
+/* Called through the pointer so the selection is not inlined into the loop. */
+static void ( * volatile pxSelect )( void ) = vTaskSwitchContext;
+
+/*-----------------------------------------------------------*/
+
+volatile uint8_t SREG;
+
+void vAvrSimInterruptsEnabled( void )
+{
+}
+
+portSTACK_TYPE *pxPortInitialiseStack( portSTACK_TYPE *pxTopOfStack, pdTASK_CODE pxCode, void *pvParameters )
+{
+	( void ) pxCode;
+	( void ) pvParameters;
+
+	return pxTopOfStack;
+}
+
+portBASE_TYPE xPortStartScheduler( void )
+{
+	return pdFALSE;
+}
+
+void vPortEndScheduler( void )
+{
+}
+
+void vPortEnterCritical( void )
+{
+}
+
+void vPortExitCritical( void )
+{
+}
+
+void vPortYield( void )
+{
+	/* The scheduler is never started, so the kernel never yields. */
+	abort();
+}
+
+void vApplicationTickHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+static void prvTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+	}
+}
+/*-----------------------------------------------------------*/
+
+static double prvNs( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( double ) xNow.tv_sec * 1e9 + ( double ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Fastest of benchRUNS loops of selections in ns per selection, each
+ * selection after a task of the highest priority blocked when xAfterTop is
+ * set.  *pulSteps is the number of empty ready lists the last selection
+ * stepped over.
+ */
+static double prvTime( portBASE_TYPE xAfterTop, unsigned long *pulSteps )
+{
+double dStart, dNs, dBest = 0.0;
+unsigned long ulSelection;
+unsigned portBASE_TYPE uxFrom = uxTopReadyPriority;
+int iRun;
+
+	for( iRun = 0; iRun < benchRUNS; iRun++ )
+	{
+		dStart = prvNs();
+		for( ulSelection = 0; ulSelection < benchSELECTIONS; ulSelection++ )
+		{
+			if( xAfterTop != pdFALSE )
+			{
+				uxTopReadyPriority = configMAX_PRIORITIES - 1;
+			}
+			uxFrom = uxTopReadyPriority;
+			pxSelect();
+		}
+		dNs = ( prvNs() - dStart ) / ( double ) benchSELECTIONS;
+
+		if( ( iRun == 0 ) || ( dNs < dBest ) )
+		{
+			dBest = dNs;
+		}
+	}
+
+	/* The bitmap does not step over the lists. */
+	*pulSteps = ( configUSE_READY_BITMAP == 1 ) ? 0UL : ( unsigned long ) ( uxFrom - uxTopReadyPriority );
+
+	return dBest;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+double dAfterTop, dSteady;
+unsigned long ulStepsAfterTop, ulStepsSteady;
+
+	/* Two tasks at the idle priority and one above it, as the idle task and
+	the UI task waiting for nothing but the processor. */
+	xTaskCreate( prvTask, ( signed char * ) "IDLE0", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+	xTaskCreate( prvTask, ( signed char * ) "IDLE1", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL );
+	xTaskCreate( prvTask, ( signed char * ) "LOW", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL );
+
+	dAfterTop = prvTime( pdTRUE, &ulStepsAfterTop );
+	dSteady = prvTime( pdFALSE, &ulStepsSteady );
+
+	printf( "%2lu priorities, ready bitmap %-3s: %6.2f ns per selection after the top priority blocked (%lu lists stepped over), %6.2f ns steady (%lu)\n",
+			( unsigned long ) configMAX_PRIORITIES, ( configUSE_READY_BITMAP == 1 ) ? "on" : "off",
+			dAfterTop, ulStepsAfterTop, dSteady, ulStepsSteady );
+
+	return EXIT_SUCCESS;
+}
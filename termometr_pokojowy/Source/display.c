@@ -0,0 +1,194 @@
+/*
+ * display.c
+ *
+ *  Wyświetlacz LED z podwójnym buforem, jasnością i miganiem; opis w display.h.
+ */
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "hal.h"
+#include "display.h"
+
+
+/**
+    Tablica konwersji wartosci BIN na kod wskaznika siedmiosegmentowego
+ */
+static const uint8_t seg7[] PROGMEM = { 0b00111111, 0b00000110, 0b01011011, 0b01001111, 0b01100110,
+	                                    0b01101101, 0b01111101, 0b00000111, 0b01111111, 0b01101111};
+
+///potęgi 10 dla display_number
+static const uint16_t pow10[DISPLAY_DIGITS-1] PROGMEM = { 1000, 100, 10 };
+
+
+static display_frame_t frames[2];
+static volatile uint8_t front;			// ramka wyświetlana
+static volatile uint8_t swap;			// ramka frames[!front] czeka na wyświetlenie
+
+static uint8_t ptr;						// bieżąca cyfra
+static uint8_t off_phase;				// następne przerwanie gasi cyfrę przed końcem szczeliny
+static uint8_t blink_cnt, blink_off;
+
+// wartości portów wyliczone na początku przebiegu cyfr - w szczelinie tylko zapisy, bez odczytu portu
+static uint8_t port_off;				// LED_digits: wszystkie cyfry zgaszone
+static uint8_t port_on[DISPLAY_DIGITS];		// LED_digits: cyfra i zapalona
+static uint8_t port_seg[DISPLAY_DIGITS];	// LED_segments (po miganiu)
+static uint8_t slot_on[DISPLAY_DIGITS];		// czas świecenia cyfry w taktach Timer0
+
+
+
+static void display_clear( display_frame_t *f )
+{
+	uint8_t i;
+
+	for( i=0; i<DISPLAY_DIGITS; i++ ) {
+		f->seg[i] = DISPLAY_BLANK;
+		f->on[i] = DISPLAY_SLOT_TICKS;
+	}
+	f->blink = 0;
+}
+
+
+void display_init(void)
+{
+	uint8_t i;
+
+	display_clear( &frames[0] );
+	display_clear( &frames[1] );
+
+	// porty wyswietlacza LED; pozostałe bity LED_digits nie mogą się już zmieniać
+	HAL_OUT(LED_digits_DDR, LED_digits_DDR | LED_DIGITS_MASK);
+	port_off = LED_digits | LED_DIGITS_MASK;
+	for( i=0; i<DISPLAY_DIGITS; i++ ) {
+		port_on[i] = port_off & ~(1<<i);
+		port_seg[i] = HAL_SEGMENTS_VALUE( DISPLAY_BLANK );
+		slot_on[i] = DISPLAY_SLOT_TICKS;
+	}
+	ptr = DISPLAY_DIGITS - 1;	// pierwsze przerwanie zaczyna przebieg cyfr
+	HAL_DIGITS_WRITE(port_off);
+	HAL_OUT(LED_segments_DDR, 0xFF);
+	HAL_SEGMENTS_WRITE(HAL_SEGMENTS_VALUE( DISPLAY_BLANK ));
+
+	// Timer0: tryb normalny (licznik bez zerowania), preskaler 1024, F_CPU=16MHz;
+	// przerwanie przesuwa OCR0 o czas do następnego zdarzenia, więc opóźnienie
+	// obsługi przerwania nie wydłuża szczelin
+	TIMSK |= (1<<OCIE0);
+	OCR0 = DISPLAY_SLOT_TICKS;
+	TCCR0 |= (1<<CS02) | (0<<CS01) | (1<<CS00);
+}
+
+
+display_frame_t *display_begin(void)
+{
+	display_frame_t *f;
+
+	// poprzednia ramka jeszcze nie trafiła na wyświetlacz (najwyżej jeden przebieg cyfr)
+	while( swap ) vTaskDelay( 1 );
+
+	f = &frames[front ^ 1];
+	display_clear( f );
+	return f;
+}
+
+
+void display_commit(void)
+{
+	swap = 1;
+}
+
+
+void display_set_level( display_frame_t *f, uint8_t mask, uint8_t level )
+{
+	uint8_t i;
+
+	if( level == 0 ) level = 1;
+	if( level > DISPLAY_LEVELS ) level = DISPLAY_LEVELS;
+
+	for( i=0; i<DISPLAY_DIGITS; i++ ) {
+		if( mask & (1<<i) )
+			f->on[i] = (uint8_t)(((uint16_t)DISPLAY_SLOT_TICKS * level + DISPLAY_LEVELS - 1) / DISPLAY_LEVELS);
+	}
+}
+
+
+uint8_t display_seg7( uint8_t digit )
+{
+	return pgm_read_byte(&seg7[digit]);
+}
+
+
+uint8_t display_number( display_frame_t *f, uint16_t val, uint8_t min_digits )
+{
+	uint8_t d[DISPLAY_DIGITS], i, n;
+	uint16_t p;
+
+	// cyfry dziesiętne bez dzielenia, przez odejmowanie kolejnych potęg 10
+	for( i=0; i<DISPLAY_DIGITS-1; i++ ) {
+		p = pgm_read_word(&pow10[i]);
+		for( n=0; val>=p; n++ ) val -= p;
+		d[DISPLAY_DIGITS-1-i] = n;
+	}
+	d[0] = (uint8_t)val;
+
+	for( n=DISPLAY_DIGITS; n>min_digits && d[n-1]==0; n-- )
+		;
+	for( i=0; i<DISPLAY_DIGITS; i++ )
+		f->seg[i] = (i<n) ? display_seg7( d[i] ) : DISPLAY_BLANK;
+	return n;
+}
+
+
+///początek przebiegu cyfr: zamiana buforów, faza migania, wartości portów na cały przebieg
+static void display_frame_start(void)
+{
+	display_frame_t *f;
+	uint8_t i, hide;
+
+	if( swap ) {
+		front ^= 1;
+		swap = 0;
+	}
+	if( ++blink_cnt >= DISPLAY_BLINK_FRAMES ) {
+		blink_cnt = 0;
+		blink_off = !blink_off;
+	}
+
+	f = &frames[front];
+	hide = blink_off ? f->blink : 0;
+	for( i=0; i<DISPLAY_DIGITS; i++ ) {
+		port_seg[i] = HAL_SEGMENTS_VALUE( (hide & (1<<i)) ? DISPLAY_BLANK : f->seg[i] );
+		slot_on[i] = f->on[i];
+	}
+}
+
+
+/* Szczelina cyfry: trzy zapisy portów i OCR0, bez wywołań jądra. Raz na
+   DISPLAY_DIGITS szczelin dochodzi display_frame_start (pętla po cyfrach).
+   Takty każdej ścieżki mierzy Target/Makefile (make cycles). */
+ISR(TIMER0_COMP_vect)
+{
+	uint8_t on;
+
+	// koniec świecenia przyciemnionej cyfry, reszta szczeliny wygaszona
+	if( off_phase ) {
+		off_phase = 0;
+		HAL_DIGITS_WRITE( port_off );
+		OCR0 += DISPLAY_SLOT_TICKS - slot_on[ptr];
+		return;
+	}
+
+	HAL_DIGITS_WRITE( port_off );
+	if( ++ptr >= DISPLAY_DIGITS ) {
+		ptr = 0;
+		display_frame_start();
+	}
+	HAL_SEGMENTS_WRITE( port_seg[ptr] );
+	HAL_DIGITS_WRITE( port_on[ptr] );
+
+	on = slot_on[ptr];
+	off_phase = ( on < DISPLAY_SLOT_TICKS );
+	OCR0 += on;
+}
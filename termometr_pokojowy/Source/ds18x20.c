@@ -1,211 +1,551 @@
-/************************************************************************/
-/*                                                                      */
-/*        Access Dallas 1-Wire Device with ATMEL AVRs                   */
-/*                                                                      */
-/*              Author: Peter Dannegger                                 */
-/*                      danni@specs.de                                  */
-/*                                                                      */
-/* modified by Martin Thomas <eversmith@heizung-thomas.de> 9/2004       */
-/************************************************************************/
-/*
- * ds18x20.c
- *
- *  Created on: 2009-08-22
- *      modyfikacje: Mirosaw Karda
- */
-#include <avr/io.h>
-//#include <util/delay.h>
-
-#include "ds18x20.h"
-#include "onewire.h"
-#include "crc8.h"
-
-
-
-uint8_t gSensorIDs[MAXSENSORS][OW_ROMCODE_SIZE];
-
-
-
-uint8_t DS18X20_meas_to_cel( uint8_t fc, uint8_t *sp,
-	uint8_t* subzero, uint8_t* cel, uint8_t* cel_frac_bits)
-{
-	uint16_t meas;
-	uint8_t  i;
-	uint8_t t_tab1[16] = {0,1,1,2,2,3,4,4,5,6,6,7,7,8,9,9};
-
-	meas = sp[0];  // LSB
-	meas |= ((uint16_t)sp[1])<<8; // MSB
-	//meas = 0xff5e; meas = 0xfe6f;
-
-	//  only work on 12bit-base
-	if( fc == DS18S20_ID ) { // 9 -> 12 bit if 18S20
-		/* Extended measurements for DS18S20 contributed by Carsten Foss */
-		meas &= (uint16_t) 0xfffe;	// Discard LSB , needed for later extended precicion calc
-		meas <<= 3;					// Convert to 12-bit , now degrees are in 1/16 degrees units
-		meas += (16 - sp[6]) - 4;	// Add the compensation , and remember to subtract 0.25 degree (4/16)
-	}
-
-	// check for negative
-	if ( meas & 0x8000 )  {
-		*subzero=1;      // mark negative
-		meas ^= 0xffff;  // convert to positive => (twos complement)++
-		meas++;
-	}
-	else *subzero=0;
-
-	// clear undefined bits for B != 12bit
-	if ( fc == DS18B20_ID ) { // check resolution 18B20
-		i = sp[DS18B20_CONF_REG];
-		if ( (i & DS18B20_12_BIT) == DS18B20_12_BIT ) {}
-		else if ( (i & DS18B20_11_BIT) == DS18B20_11_BIT )
-			meas &= ~(DS18B20_11_BIT_UNDF);
-		else if ( (i & DS18B20_10_BIT) == DS18B20_10_BIT )
-			meas &= ~(DS18B20_10_BIT_UNDF);
-		else { // if ( (i & DS18B20_9_BIT) == DS18B20_9_BIT ) {
-			meas &= ~(DS18B20_9_BIT_UNDF);
-		}
-	}
-
-	*cel  = (uint8_t)(meas >> 4);
-	*cel_frac_bits = t_tab1[(uint8_t)(meas & 0x000F)]    ;
-
-
-	return DS18X20_OK;
-}
-
-
-
-/* compare temperature values (full celsius only)
-   returns -1 if param-pair1 < param-pair2
-            0 if ==
-			1 if >    */
-int DS18X20_temp_cmp(uint8_t subzero1, uint16_t cel1,
-	uint8_t subzero2, uint16_t cel2)
-{
-	int16_t t1 = (subzero1) ? (cel1*(-1)) : (cel1);
-	int16_t t2 = (subzero2) ? (cel2*(-1)) : (cel2);
-
-	if (t1<t2) return -1;
-	if (t1>t2) return 1;
-	return 0;
-}
-
-/* find DS18X20 Sensors on 1-Wire-Bus
-   input/ouput: diff is the result of the last rom-search
-   output: id is the rom-code of the sensor found */
-void DS18X20_find_sensor(uint8_t *diff, uint8_t id[])
-{
-	for (;;) {
-		*diff = ow_rom_search( *diff, &id[0] );
-		if ( *diff==OW_PRESENCE_ERR || *diff==OW_DATA_ERR ||
-		  *diff == OW_LAST_DEVICE ) return;
-		if ( id[0] == DS18B20_ID || id[0] == DS18S20_ID ) return;
-	}
-}
-
-
-
-uint8_t search_sensors(void)
-{
-	uint8_t i;
-	uint8_t id[OW_ROMCODE_SIZE];
-	uint8_t diff, nSensors;
-
-	nSensors = 0;
-
-	for( diff = OW_SEARCH_FIRST;
-		diff != OW_LAST_DEVICE && nSensors < MAXSENSORS ; )
-	{
-		DS18X20_find_sensor( &diff, &id[0] );
-
-		if( diff == OW_PRESENCE_ERR ) {
-			break;
-		}
-
-		if( diff == OW_DATA_ERR ) {
-			break;
-		}
-
-		for (i=0;i<OW_ROMCODE_SIZE;i++) gSensorIDs[nSensors][i]=id[i];
-
-		nSensors++;
-	}
-
-	return nSensors;
-}
-
-
-
-
-/* get power status of DS18x20
-   input  : id = rom_code
-   returns: DS18X20_POWER_EXTERN or DS18X20_POWER_PARASITE */
-uint8_t	DS18X20_get_power_status(uint8_t id[])
-{
-	uint8_t pstat;
-	if( ow_reset() ) return DS18X20_ERROR;
-    ow_command(DS18X20_READ_POWER_SUPPLY, id);
-    pstat=ow_bit_io(1); // pstat 0=is parasite/ !=0 ext. powered
-    ow_reset();
-	return (pstat) ? DS18X20_POWER_EXTERN:DS18X20_POWER_PARASITE;
-}
-
-/* start measurement (CONVERT_T) for all sensors if input id==NULL
-   or for single sensor. then id is the rom-code */
-uint8_t DS18X20_start_meas( uint8_t with_power_extern, uint8_t id[])
-{
-	if( ow_reset() ) return DS18X20_ERROR;
-
-	if( ow_input_pin_state() ) { // only send if bus is "idle" = high
-		ow_command( DS18X20_CONVERT_T, id );
-		if (with_power_extern != DS18X20_POWER_EXTERN)
-			ow_parasite_enable();
-		return DS18X20_OK;
-	}
-	else {
-
-		return DS18X20_START_FAIL;
-	}
-}
-
-/* reads temperature (scratchpad) of sensor with rom-code id
-   output: subzero==1 if temp.<0, cel: full celsius, mcel: frac
-   in millicelsius*0.1
-   i.e.: subzero=1, cel=18, millicel=5000 = -18,5000C */
-uint8_t DS18X20_read_meas(uint8_t *id, uint8_t *subzero, uint8_t *cel, uint8_t *cel_frac_bits)
-{
-	uint8_t i;
-	uint8_t sp[DS18X20_SP_SIZE];
-
-	if( ow_reset() ) return DS18X20_ERROR;
-
-	ow_command(DS18X20_READ, id);
-	for ( i=0 ; i< DS18X20_SP_SIZE; i++ ) sp[i]=ow_byte_rd();
-	if ( crc8( &sp[0], DS18X20_SP_SIZE ) )
-		return DS18X20_ERROR_CRC;
-	DS18X20_meas_to_cel(id[0], sp, subzero, cel, cel_frac_bits);
-	return DS18X20_OK;
-}
-
-/* reads temperature (scratchpad) of a single sensor (uses skip-rom)
-   output: subzero==1 if temp.<0, cel: full celsius, mcel: frac
-   in millicelsius*0.1
-   i.e.: subzero=1, cel=18, millicel=5000 = -18,5000C */
-uint8_t DS18X20_read_meas_single(uint8_t familycode, uint8_t *subzero, uint8_t *cel, uint8_t *cel_frac_bits)
-{
-	uint8_t i;
-	uint8_t sp[DS18X20_SP_SIZE];
-
-	if( ow_reset() ) return DS18X20_ERROR;
-
-	ow_command(DS18X20_READ, NULL);
-	for ( i=0 ; i< DS18X20_SP_SIZE; i++ ) sp[i]=ow_byte_rd();
-	if ( crc8( &sp[0], DS18X20_SP_SIZE ) )
-		return DS18X20_ERROR_CRC;
-	DS18X20_meas_to_cel(familycode, sp, subzero, cel, cel_frac_bits);
-
-
-	return DS18X20_OK;
-}
-
-
+/************************************************************************/
+/*                                                                      */
+/*        Access Dallas 1-Wire Device with ATMEL AVRs                   */
+/*                                                                      */
+/*              Author: Peter Dannegger                                 */
+/*                      danni@specs.de                                  */
+/*                                                                      */
+/* modified by Martin Thomas <eversmith@heizung-thomas.de> 9/2004       */
+/************************************************************************/
+/*
+ * ds18x20.c
+ *
+ *  Created on: 2009-08-22
+ *      modyfikacje: Mirosław Kardaś
+ */
+#include <avr/io.h>
+//#include <util/delay.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "ds18x20.h"
+#include "onewire.h"
+#include "crc8.h"
+#if DS18X20_USE_ENGINE
+#include "ow_engine.h"
+#endif
+
+
+
+uint8_t gSensorIDs[MAXSENSORS][OW_ROMCODE_SIZE];
+
+
+
+/* converts the temperature of scratchpad sp of a sensor with family code
+   fc to 1/16°C (see DS18X20_TEMP_CEL); DS18S20 values are extended to
+   12 bits, undefined bits of a DS18B20 below 12 bits are cleared */
+int16_t DS18X20_sp_to_temp(uint8_t fc, uint8_t *sp)
+{
+	int16_t meas;
+	uint8_t i;
+
+	meas = (int16_t)(sp[0] | ((uint16_t)sp[1]<<8));
+
+	if( fc == DS18S20_ID ) { // 9 -> 12 bit if 18S20
+		/* Extended measurements for DS18S20 contributed by Carsten Foss */
+		meas &= (int16_t) 0xfffe;	// Discard LSB , needed for later extended precicion calc
+		meas *= 8;					// Convert to 12-bit , now degrees are in 1/16 degrees units
+		meas += (16 - sp[6]) - 4;	// Add the compensation , and remember to subtract 0.25 degree (4/16)
+	}
+	else if( fc == DS18B20_ID ) { // check resolution 18B20
+		i = sp[DS18B20_CONF_REG] & DS18B20_12_BIT;
+		if ( i == DS18B20_11_BIT ) meas &= ~(DS18B20_11_BIT_UNDF);
+		else if ( i == DS18B20_10_BIT ) meas &= ~(DS18B20_10_BIT_UNDF);
+		else if ( i == DS18B20_9_BIT ) meas &= ~(DS18B20_9_BIT_UNDF);
+	}
+
+	return meas;
+}
+
+uint8_t DS18X20_meas_to_cel( uint8_t fc, uint8_t *sp,
+	uint8_t* subzero, uint8_t* cel, uint8_t* cel_frac_bits)
+{
+	uint16_t meas;
+	uint8_t t_tab1[16] = {0,1,1,2,2,3,4,4,5,6,6,7,7,8,9,9};
+
+	meas = DS18X20_sp_to_temp( fc, sp );
+
+	// check for negative
+	if ( meas & 0x8000 )  {
+		*subzero=1;      // mark negative
+		meas ^= 0xffff;  // convert to positive => (twos complement)++
+		meas++;
+	}
+	else *subzero=0;
+
+	*cel  = (uint8_t)(meas >> 4);
+	*cel_frac_bits = t_tab1[(uint8_t)(meas & 0x000F)]    ;
+
+
+	return DS18X20_OK;
+}
+
+/* 1/16°C -> 0.1°C, rounded (half up) */
+int16_t DS18X20_temp_to_decicel(int16_t temp)
+{
+	return (temp*10 + 8) >> 4;
+}
+
+/* 0.1°C -> 1/16°C, rounded; DS18X20_temp_to_decicel gives back decicel */
+int16_t DS18X20_decicel_to_temp(int16_t decicel)
+{
+	if( decicel < 0 ) return -(int16_t)((-decicel*16 + 5) / 10);
+	return (decicel*16 + 5) / 10;
+}
+
+
+
+/* compare temperature values (full celsius only)
+   returns -1 if param-pair1 < param-pair2
+            0 if ==
+			1 if >    */
+int DS18X20_temp_cmp(uint8_t subzero1, uint16_t cel1,
+	uint8_t subzero2, uint16_t cel2)
+{
+	int16_t t1 = (subzero1) ? (cel1*(-1)) : (cel1);
+	int16_t t2 = (subzero2) ? (cel2*(-1)) : (cel2);
+
+	if (t1<t2) return -1;
+	if (t1>t2) return 1;
+	return 0;
+}
+
+/* find DS18X20 Sensors on 1-Wire-Bus
+   input/ouput: diff is the result of the last rom-search
+   output: id is the rom-code of the sensor found */
+void DS18X20_find_sensor(uint8_t *diff, uint8_t id[])
+{
+	for (;;) {
+		*diff = ow_rom_search( *diff, &id[0] );
+		if ( *diff==OW_PRESENCE_ERR || *diff==OW_DATA_ERR ||
+		  *diff == OW_LAST_DEVICE ) return;
+		if ( id[0] == DS18B20_ID || id[0] == DS18S20_ID ) return;
+	}
+}
+
+
+
+uint8_t search_sensors(void)
+{
+	uint8_t i;
+	uint8_t id[OW_ROMCODE_SIZE];
+	uint8_t diff, nSensors;
+
+	nSensors = 0;
+
+	for( diff = OW_SEARCH_FIRST;
+		diff != OW_LAST_DEVICE && nSensors < MAXSENSORS ; )
+	{
+		DS18X20_find_sensor( &diff, &id[0] );
+
+		if( diff == OW_PRESENCE_ERR ) {
+			break;
+		}
+
+		if( diff == OW_DATA_ERR ) {
+			break;
+		}
+
+		for (i=0;i<OW_ROMCODE_SIZE;i++) gSensorIDs[nSensors][i]=id[i];
+
+		nSensors++;
+	}
+
+	return nSensors;
+}
+
+
+
+
+#if DS18X20_USE_ENGINE
+
+/* get power status of DS18x20
+   input  : id = rom_code
+   returns: DS18X20_POWER_EXTERN or DS18X20_POWER_PARASITE */
+uint8_t	DS18X20_get_power_status(uint8_t id[])
+{
+	uint8_t pstat;
+	ow_transaction_t t = { id, DS18X20_READ_POWER_SUPPLY, NULL, 0, &pstat, 1, 0, 0, NULL };
+
+	if( ow_engine_transfer( &t ) != OW_ENGINE_OK ) return DS18X20_ERROR;
+	// pstat bit 0: 0=is parasite/ !=0 ext. powered
+	return (pstat & 1) ? DS18X20_POWER_EXTERN:DS18X20_POWER_PARASITE;
+}
+
+/* start measurement (CONVERT_T) for all sensors if input id==NULL
+   or for single sensor. then id is the rom-code */
+uint8_t DS18X20_start_meas( uint8_t with_power_extern, uint8_t id[])
+{
+	ow_transaction_t t = { id, DS18X20_CONVERT_T, NULL, 0, NULL, 0, 0, 0, NULL };
+
+	if (with_power_extern != DS18X20_POWER_EXTERN)
+		t.flags = OW_TR_STRONG_PULLUP;
+	// brak impulsu obecności albo zwarta linia - jak przy bus != "idle"
+	if( ow_engine_transfer( &t ) != OW_ENGINE_OK ) return DS18X20_START_FAIL;
+	return DS18X20_OK;
+}
+
+/* wait for the end of the conversion started by DS18X20_start_meas
+   (only the task calling it is blocked)
+   input  : with_power_extern as for DS18X20_start_meas, tconv = conversion
+            time in ms (DS18B20_TCONV_*)
+   externally powered sensors answer read-time-slots with 0 while converting,
+   they are polled every DS18X20_POLL_MS; parasite powered ones need the
+   strong pull-up all the time, there only tconv is waited
+   returns: DS18X20_OK, DS18X20_ERROR if not done within tconv */
+uint8_t DS18X20_wait_meas( uint8_t with_power_extern, uint16_t tconv )
+{
+	uint8_t b;
+	uint16_t t;
+	ow_transaction_t tr = { NULL, 0, NULL, 0, &b, 1, OW_TR_NO_RESET, 0, NULL };
+
+	if (with_power_extern != DS18X20_POWER_EXTERN) {
+		vTaskDelay( tconv / portTICK_RATE_MS );
+		return DS18X20_OK;
+	}
+
+	for( t = 0; t <= tconv; t += DS18X20_POLL_MS ) {
+		vTaskDelay( DS18X20_POLL_MS / portTICK_RATE_MS );
+		if( ow_engine_transfer( &tr ) != OW_ENGINE_OK ) return DS18X20_ERROR;
+		if( b ) return DS18X20_OK;		// 8 read-time-slots, any 1 = done
+	}
+	return DS18X20_ERROR;
+}
+
+/* flagi odczytu scratchpadu: CRC sprawdzane w przerwaniu, przerwanie
+   odczytu po pierwszym bajcie 0xFF, którego czujnik nie może wysłać */
+static uint8_t DS18X20_read_flags( uint8_t id[] )
+{
+	if( id && id[0] == DS18B20_ID )
+		return OW_TR_CRC | OW_TR_FF_ABORT( DS18B20_SP_FF_MAX + 1 );
+	return OW_TR_CRC | OW_TR_FF_ABORT( DS18S20_SP_FF_MAX + 1 );
+}
+
+static uint8_t DS18X20_read_status( uint8_t status )
+{
+	if( status == OW_ENGINE_OK ) return DS18X20_OK;
+	if( status == OW_ENGINE_CRC_ERR ) return DS18X20_ERROR_CRC;
+	return DS18X20_ERROR;
+}
+
+/* reads the scratchpad of sensor with rom-code id (NULL = skip-rom, single
+   sensor) into sp[DS18X20_SP_SIZE]; a read with a bad CRC is repeated
+   up to DS18X20_READ_RETRIES times
+   returns: DS18X20_OK, DS18X20_ERROR, DS18X20_ERROR_CRC */
+uint8_t DS18X20_read_scratchpad( uint8_t id[], uint8_t sp[] )
+{
+	ow_transaction_t t = { id, DS18X20_READ, NULL, 0, sp, DS18X20_SP_SIZE, 0, 0, NULL };
+	uint8_t retries = DS18X20_READ_RETRIES;
+
+	t.flags = DS18X20_read_flags( id );
+	while( ow_engine_transfer( &t ) == OW_ENGINE_CRC_ERR && retries-- )
+		;
+	return DS18X20_read_status( t.status );
+}
+
+
+/* writes TH, TL and (DS18B20 only) the configuration register of sensor
+   with rom-code id (NULL = all sensors, skip-rom) */
+uint8_t DS18X20_write_scratchpad( uint8_t id[], uint8_t th, uint8_t tl, uint8_t conf )
+{
+	uint8_t b[3];
+	ow_transaction_t t = { id, DS18X20_WRITE, b, 3, NULL, 0, 0, 0, NULL };
+
+	b[0] = th;
+	b[1] = tl;
+	b[2] = conf;	// DS18S20 ignores the 3rd byte
+	if( ow_engine_transfer( &t ) != OW_ENGINE_OK ) return DS18X20_ERROR;
+	return DS18X20_OK;
+}
+
+/* copies TH, TL and configuration from the scratchpad to the EEPROM of
+   sensor with rom-code id (NULL = all sensors), waits for the write */
+uint8_t DS18X20_copy_scratchpad( uint8_t with_power_extern, uint8_t id[] )
+{
+	ow_transaction_t t = { id, DS18X20_EE_WRITE, NULL, 0, NULL, 0, 0, 0, NULL };
+
+	if (with_power_extern != DS18X20_POWER_EXTERN)
+		t.flags = OW_TR_STRONG_PULLUP;
+	if( ow_engine_transfer( &t ) != OW_ENGINE_OK ) return DS18X20_ERROR;
+	vTaskDelay( DS18X20_TEE_WRITE / portTICK_RATE_MS );
+	return DS18X20_OK;
+}
+
+/* reads temperature (scratchpad) of sensor with rom-code id
+   output: subzero==1 if temp.<0, cel: full celsius, mcel: frac
+   in millicelsius*0.1
+   i.e.: subzero=1, cel=18, millicel=5000 = -18,5000°C */
+uint8_t DS18X20_read_meas(uint8_t *id, uint8_t *subzero, uint8_t *cel, uint8_t *cel_frac_bits)
+{
+	uint8_t sp[DS18X20_SP_SIZE];
+	uint8_t err;
+
+	err = DS18X20_read_scratchpad( id, sp );
+	if( err != DS18X20_OK ) return err;
+	DS18X20_meas_to_cel(id[0], sp, subzero, cel, cel_frac_bits);
+	return DS18X20_OK;
+}
+
+/* reads temperature (scratchpad) of a single sensor (uses skip-rom)
+   output: subzero==1 if temp.<0, cel: full celsius, mcel: frac
+   in millicelsius*0.1
+   i.e.: subzero=1, cel=18, millicel=5000 = -18,5000°C */
+uint8_t DS18X20_read_meas_single(uint8_t familycode, uint8_t *subzero, uint8_t *cel, uint8_t *cel_frac_bits)
+{
+	uint8_t sp[DS18X20_SP_SIZE];
+	uint8_t err;
+
+	err = DS18X20_read_scratchpad( NULL, sp );
+	if( err != DS18X20_OK ) return err;
+	DS18X20_meas_to_cel(familycode, sp, subzero, cel, cel_frac_bits);
+	return DS18X20_OK;
+}
+
+/* reads temperature (scratchpad) of the first n sensors of gSensorIDs,
+   all reads are queued at once so the bus goes from one sensor to the
+   next without waiting for the task; a read with a bad CRC is queued
+   again right away (up to DS18X20_READ_RETRIES times)
+   output: temp[i] in 1/16°C, per sensor; err[i] = its status, temp[i]
+   is left unchanged if not DS18X20_OK
+   returns DS18X20_OK if all sensors were read */
+uint8_t DS18X20_read_raw_all(uint8_t n, int16_t temp[], uint8_t err[])
+{
+	static ow_transaction_t t[MAXSENSORS];
+	static uint8_t sp[MAXSENSORS][DS18X20_SP_SIZE];
+	uint8_t i, retries, res = DS18X20_OK;
+
+	for ( i=0 ; i<n ; i++ ) {
+		t[i].id = gSensorIDs[i];
+		t[i].command = DS18X20_READ;
+		t[i].wr_len = 0;
+		t[i].rd = sp[i];
+		t[i].rd_len = DS18X20_SP_SIZE;
+		t[i].flags = DS18X20_read_flags( gSensorIDs[i] );
+		t[i].done = NULL;
+		ow_engine_submit( &t[i] );
+	}
+
+	for ( i=0 ; i<n ; i++ ) {
+		retries = DS18X20_READ_RETRIES;
+		while( ow_engine_wait( &t[i] ) == OW_ENGINE_CRC_ERR && retries-- )
+			ow_engine_submit( &t[i] );
+		err[i] = DS18X20_read_status( t[i].status );
+		if( err[i] == DS18X20_OK ) temp[i] = DS18X20_sp_to_temp( gSensorIDs[i][0], sp[i] );
+		else res = err[i];
+	}
+
+	return res;
+}
+
+#else
+
+/* get power status of DS18x20
+   input  : id = rom_code
+   returns: DS18X20_POWER_EXTERN or DS18X20_POWER_PARASITE */
+uint8_t	DS18X20_get_power_status(uint8_t id[])
+{
+	uint8_t pstat;
+	if( ow_reset() ) return DS18X20_ERROR;
+    ow_command(DS18X20_READ_POWER_SUPPLY, id);
+    pstat=ow_bit_io(1); // pstat 0=is parasite/ !=0 ext. powered
+    ow_reset();
+	return (pstat) ? DS18X20_POWER_EXTERN:DS18X20_POWER_PARASITE;
+}
+
+/* start measurement (CONVERT_T) for all sensors if input id==NULL
+   or for single sensor. then id is the rom-code */
+uint8_t DS18X20_start_meas( uint8_t with_power_extern, uint8_t id[])
+{
+	if( ow_reset() ) return DS18X20_ERROR;
+
+	if( ow_input_pin_state() ) { // only send if bus is "idle" = high
+		ow_command( DS18X20_CONVERT_T, id );
+		if (with_power_extern != DS18X20_POWER_EXTERN)
+			ow_parasite_enable();
+		return DS18X20_OK;
+	}
+	else {
+
+		return DS18X20_START_FAIL;
+	}
+}
+
+/* wait for the end of the conversion started by DS18X20_start_meas
+   (only the task calling it is blocked)
+   input  : with_power_extern as for DS18X20_start_meas, tconv = conversion
+            time in ms (DS18B20_TCONV_*)
+   externally powered sensors answer read-time-slots with 0 while converting,
+   they are polled every DS18X20_POLL_MS; parasite powered ones need the
+   strong pull-up all the time, there only tconv is waited
+   returns: DS18X20_OK, DS18X20_ERROR if not done within tconv */
+uint8_t DS18X20_wait_meas( uint8_t with_power_extern, uint16_t tconv )
+{
+	uint16_t t;
+
+	if (with_power_extern != DS18X20_POWER_EXTERN) {
+		vTaskDelay( tconv / portTICK_RATE_MS );
+		return DS18X20_OK;
+	}
+
+	for( t = 0; t <= tconv; t += DS18X20_POLL_MS ) {
+		vTaskDelay( DS18X20_POLL_MS / portTICK_RATE_MS );
+		if( ow_bit_io( 1 ) ) return DS18X20_OK;
+	}
+	return DS18X20_ERROR;
+}
+
+/* reads temperature (scratchpad) of sensor with rom-code id
+   output: subzero==1 if temp.<0, cel: full celsius, mcel: frac
+   in millicelsius*0.1
+   i.e.: subzero=1, cel=18, millicel=5000 = -18,5000°C */
+uint8_t DS18X20_read_meas(uint8_t *id, uint8_t *subzero, uint8_t *cel, uint8_t *cel_frac_bits)
+{
+	uint8_t sp[DS18X20_SP_SIZE];
+	uint8_t err;
+
+	err = DS18X20_read_scratchpad( id, sp );
+	if( err != DS18X20_OK ) return err;
+	DS18X20_meas_to_cel(id[0], sp, subzero, cel, cel_frac_bits);
+	return DS18X20_OK;
+}
+
+/* reads temperature (scratchpad) of a single sensor (uses skip-rom)
+   output: subzero==1 if temp.<0, cel: full celsius, mcel: frac
+   in millicelsius*0.1
+   i.e.: subzero=1, cel=18, millicel=5000 = -18,5000°C */
+uint8_t DS18X20_read_meas_single(uint8_t familycode, uint8_t *subzero, uint8_t *cel, uint8_t *cel_frac_bits)
+{
+	uint8_t sp[DS18X20_SP_SIZE];
+	uint8_t err;
+
+	err = DS18X20_read_scratchpad( NULL, sp );
+	if( err != DS18X20_OK ) return err;
+	DS18X20_meas_to_cel(familycode, sp, subzero, cel, cel_frac_bits);
+	return DS18X20_OK;
+}
+
+/* reads the scratchpad of sensor with rom-code id (NULL = skip-rom, single
+   sensor) into sp[DS18X20_SP_SIZE]; the CRC is updated byte by byte and
+   the read stops at the first 0xFF the sensor cannot send (no answer);
+   a read with a bad CRC is repeated up to DS18X20_READ_RETRIES times
+   returns: DS18X20_OK, DS18X20_ERROR, DS18X20_ERROR_CRC */
+uint8_t DS18X20_read_scratchpad( uint8_t id[], uint8_t sp[] )
+{
+	uint8_t i, crc, ff, ff_max;
+	uint8_t retries = DS18X20_READ_RETRIES;
+
+	ff_max = ( id && id[0] == DS18B20_ID ) ? DS18B20_SP_FF_MAX : DS18S20_SP_FF_MAX;
+
+	for (;;) {
+		if( ow_reset() ) return DS18X20_ERROR;
+
+		ow_command(DS18X20_READ, id);
+		crc = CRC8INIT;
+		ff = 0;
+		for ( i=0 ; i< DS18X20_SP_SIZE; i++ ) {
+			sp[i] = ow_byte_rd();
+			crc = crc8_update( crc, sp[i] );
+			if( ff == i && sp[i] == 0xFF && ++ff > ff_max ) return DS18X20_ERROR;
+		}
+		if( crc == 0 ) return DS18X20_OK;
+		if( retries-- == 0 ) return DS18X20_ERROR_CRC;
+	}
+}
+
+/* writes TH, TL and (DS18B20 only) the configuration register of sensor
+   with rom-code id (NULL = all sensors, skip-rom) */
+uint8_t DS18X20_write_scratchpad( uint8_t id[], uint8_t th, uint8_t tl, uint8_t conf )
+{
+	if( ow_reset() ) return DS18X20_ERROR;
+
+	ow_command(DS18X20_WRITE, id);
+	ow_byte_wr(th);
+	ow_byte_wr(tl);
+	ow_byte_wr(conf);	// DS18S20 ignores the 3rd byte
+	return DS18X20_OK;
+}
+
+/* copies TH, TL and configuration from the scratchpad to the EEPROM of
+   sensor with rom-code id (NULL = all sensors), waits for the write */
+uint8_t DS18X20_copy_scratchpad( uint8_t with_power_extern, uint8_t id[] )
+{
+	if( ow_reset() ) return DS18X20_ERROR;
+
+	ow_command(DS18X20_EE_WRITE, id);
+	if (with_power_extern != DS18X20_POWER_EXTERN)
+		ow_parasite_enable();
+	vTaskDelay( DS18X20_TEE_WRITE / portTICK_RATE_MS );
+	ow_parasite_disable();
+	return DS18X20_OK;
+}
+
+/* reads temperature (scratchpad) of the first n sensors of gSensorIDs
+   output: temp[i] in 1/16°C, per sensor; err[i] = its status, temp[i]
+   is left unchanged if not DS18X20_OK
+   returns DS18X20_OK if all sensors were read */
+uint8_t DS18X20_read_raw_all(uint8_t n, int16_t temp[], uint8_t err[])
+{
+	uint8_t i, res = DS18X20_OK;
+
+	for ( i=0 ; i<n ; i++ ) {
+		err[i] = DS18X20_read_raw(gSensorIDs[i], &temp[i]);
+		if( err[i] != DS18X20_OK ) res = err[i];
+	}
+
+	return res;
+}
+
+#endif /* DS18X20_USE_ENGINE */
+
+
+/* reads temperature (scratchpad) of sensor with rom-code id (NULL =
+   skip-rom, single DS18B20)
+   output: temp in 1/16°C, i.e. -18,5°C = -296 */
+uint8_t DS18X20_read_raw(uint8_t id[], int16_t *temp)
+{
+	uint8_t sp[DS18X20_SP_SIZE];
+	uint8_t err;
+
+	err = DS18X20_read_scratchpad( id, sp );
+	if( err != DS18X20_OK ) return err;
+	*temp = DS18X20_sp_to_temp( id ? id[0] : DS18B20_ID, sp );
+	return DS18X20_OK;
+}
+
+
+/* sets the resolution of a DS18B20 (conf = DS18B20_9_BIT ... DS18B20_12_BIT),
+   TH and TL are kept; to_eeprom != 0 also stores it in the EEPROM so it
+   survives a power cycle; DS18S20 has a fixed resolution, nothing is done */
+uint8_t DS18X20_set_resolution( uint8_t id[], uint8_t conf, uint8_t with_power_extern, uint8_t to_eeprom )
+{
+	uint8_t sp[DS18X20_SP_SIZE];
+	uint8_t err;
+
+	if( id[0] != DS18B20_ID ) return DS18X20_OK;
+
+	err = DS18X20_read_scratchpad( id, sp );
+	if( err != DS18X20_OK ) return err;
+	if( (sp[DS18B20_CONF_REG] & DS18B20_12_BIT) == conf && !to_eeprom ) return DS18X20_OK;
+
+	err = DS18X20_write_scratchpad( id, sp[2], sp[3], conf );
+	if( err == DS18X20_OK && to_eeprom )
+		err = DS18X20_copy_scratchpad( with_power_extern, id );
+	return err;
+}
+
+/* conversion time in ms of a sensor with the given family code and
+   configuration register (DS18B20_9_BIT ... DS18B20_12_BIT) */
+uint16_t DS18X20_conv_time( uint8_t familycode, uint8_t conf )
+{
+	if( familycode != DS18B20_ID ) return DS18S20_TCONV;
+
+	switch( conf & DS18B20_12_BIT ) {
+	case DS18B20_9_BIT:		return DS18B20_TCONV_9BIT;
+	case DS18B20_10_BIT:	return DS18B20_TCONV_10BIT;
+	case DS18B20_11_BIT:	return DS18B20_TCONV_11BIT;
+	default:				return DS18B20_TCONV_12BIT;
+	}
+}
+
+
@@ -1,24 +1,38 @@
-/************************************************************************/
-/*                                                                      */
-/*        Access Dallas 1-Wire Device with ATMEL AVRs                   */
-/*                                                                      */
-/*              Author: Peter Dannegger                                 */
-/*                      danni@specs.de                                  */
-/*                                                                      */
-/* modified by Martin Thomas <eversmith@heizung-thomas.de> 9/2004       */
-/************************************************************************/
-/*
- * crc8.h
- *
- */
-
-#ifndef CRC8_H_
-#define CRC8_H_
-
-#include <inttypes.h>
-
-uint8_t	crc8 (uint8_t* data_in, uint16_t number_of_bytes_to_read);
-
-#endif
-
-
+/************************************************************************/
+/*                                                                      */
+/*        Access Dallas 1-Wire Device with ATMEL AVRs                   */
+/*                                                                      */
+/*              Author: Peter Dannegger                                 */
+/*                      danni@specs.de                                  */
+/*                                                                      */
+/* modified by Martin Thomas <eversmith@heizung-thomas.de> 9/2004       */
+/************************************************************************/
+/*
+ * crc8.h
+ *
+ */
+
+#ifndef CRC8_H_
+#define CRC8_H_
+
+#include <inttypes.h>
+#include <avr/pgmspace.h>
+
+#define CRC8INIT	0x00
+
+extern const uint8_t crc8_table[256] PROGMEM;
+
+// CRC of a block, 0 if the block ends with its own correct CRC byte
+uint8_t	crc8 (uint8_t* data_in, uint16_t number_of_bytes_to_read);
+
+// Add one byte to a running CRC (start with CRC8INIT), for checking
+// bytes on the fly as they come from the bus. Short enough to be
+// inlined into an interrupt handler.
+static inline uint8_t crc8_update (uint8_t crc, uint8_t data)
+{
+	return pgm_read_byte( &crc8_table[crc ^ data] );
+}
+
+#endif
+
+
@@ -0,0 +1,72 @@
+/*
+ * display.h
+ *
+ *  Sterownik multipleksowanego wyświetlacza LED (hal.h) w przerwaniu Timer0.
+ *
+ *  Przerwanie zapala kolejne cyfry na DISPLAY_SLOT_TICKS taktów Timer0 każdą.
+ *  Zadania nie piszą do bufora, który jest właśnie wyświetlany: budują nową
+ *  ramkę (display_begin), a display_commit zamienia bufory na początku
+ *  następnego pełnego przebiegu cyfr - na wyświetlaczu nigdy nie ma
+ *  połowy starej i połowy nowej zawartości.
+ *
+ *  Jasność cyfr: cyfra świeci tylko przez część swojej szczeliny, na resztę
+ *  przerwanie ustawia drugie porównanie Timer0 i gasi cyfry (PWM w szczelinie).
+ *  Timer0 liczy bez zerowania, każde przerwanie przesuwa OCR0 o czas do
+ *  następnego zdarzenia - szczeliny nie zależą od opóźnienia przerwania.
+ *  Miganie: wybrane cyfry są gaszone co DISPLAY_BLINK_FRAMES przebiegów.
+ */
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+#include <inttypes.h>
+
+#include "hal.h"
+
+
+#define DISPLAY_DIGITS			NUMBER_OF_DIGITS	// display_number zakłada 4 cyfry
+// szczelina jednej cyfry w taktach Timer0 (preskaler 1024, 64us): 31 = 1.984ms
+#define DISPLAY_SLOT_TICKS		31
+// poziomy jasności 1...DISPLAY_LEVELS (pełna)
+#define DISPLAY_LEVELS			8
+// pół okresu migania w przebiegach wszystkich cyfr (ok. 7.9ms): ok. 0.5s
+#define DISPLAY_BLINK_FRAMES	64
+
+/* segmenty (bit ustawiony = świeci) */
+#define DISPLAY_BLANK			0x00
+#define DISPLAY_MINUS			0x40
+#define DISPLAY_DP				0x80
+
+
+typedef struct display_frame {
+	uint8_t seg[DISPLAY_DIGITS];	// segmenty, seg[0] - cyfra skrajna prawa
+	uint8_t on[DISPLAY_DIGITS];		// czas świecenia w szczelinie, takty Timer0 (display_set_level)
+	uint8_t blink;					// maska migających cyfr, bit 0 = seg[0]
+} display_frame_t;
+
+
+/* porty wyświetlacza i Timer0 (tryb normalny); przerwanie TIMER0_COMP_vect jest
+   w display.c i nie robi nic poza przełączaniem cyfr - odmierzanie czasu
+   i przyciski należą do przerwania zegara systemowego (vApplicationTickHook) */
+void display_init(void);
+
+/* nowa ramka do wypełnienia (z jednego zadania): wygaszona, pełna jasność, bez migania;
+   czeka (vTaskDelay), jeśli poprzednia ramka nie została jeszcze pokazana */
+display_frame_t *display_begin(void);
+
+/* ramka z display_begin zostanie wyświetlona od następnego przebiegu cyfr */
+void display_commit(void);
+
+/* jasność 1...DISPLAY_LEVELS cyfr z maski (bit 0 = seg[0]) */
+void display_set_level( display_frame_t *f, uint8_t mask, uint8_t level );
+
+/* segmenty cyfry 0...9 */
+uint8_t display_seg7( uint8_t digit );
+
+/* liczba 0...9999 dosunięta do prawej, zera wiodące wygaszone, ale co
+   najmniej min_digits cyfr; zwraca liczbę zapisanych cyfr */
+uint8_t display_number( display_frame_t *f, uint16_t val, uint8_t min_digits );
+
+
+
+#endif /* DISPLAY_H_ */
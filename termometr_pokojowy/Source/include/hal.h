@@ -0,0 +1,86 @@
+/*
+ * hal.h
+ *
+ *  Dostęp do wyprowadzeń płytki termometru: wyświetlacz LED, diody, przyciski.
+ *
+ *  Backend wybierany w czasie kompilacji (HAL_BACKEND):
+ *  - HAL_BACKEND_AVR  - bezpośredni zapis/odczyt rejestrów, te same pojedyncze
+ *                       instrukcje out/in co przy dostępie do PORTx/PINx,
+ *  - HAL_BACKEND_HOST - symulowana płytka (Host/hal_host.c), każdy zapis do
+ *                       portu trafia z czasem do śladu, stan przycisków może
+ *                       być odtwarzany z pliku.
+ *  Domyślnie HAL_BACKEND_AVR dla avr-gcc, HAL_BACKEND_HOST w pozostałych
+ *  przypadkach.
+ */
+
+#ifndef HAL_H_
+#define HAL_H_
+
+#include <avr/io.h>
+#include <inttypes.h>
+
+#define HAL_BACKEND_AVR		0
+#define HAL_BACKEND_HOST	1
+
+#ifndef HAL_BACKEND
+	#ifdef __AVR__
+		#define HAL_BACKEND HAL_BACKEND_AVR
+	#else
+		#define HAL_BACKEND HAL_BACKEND_HOST
+	#endif
+#endif
+
+/* Podłączenie do procesora */
+#define NUMBER_OF_DIGITS	4
+///cyfry wyświetlacza LED (PB0 ... PB3, aktywne stanem niskim)
+#define LED_digits			PORTB
+#define LED_digits_DDR		DDRB
+#define LED_D0				PB0
+#define LED_D1				PB1
+#define LED_D2				PB2
+#define LED_D3				PB3
+#define LED_DIGITS_MASK		((1<<LED_D0)|(1<<LED_D1)|(1<<LED_D2)|(1<<LED_D3))
+///segmenty wyświetlacza LED (aktywne stanem niskim)
+#define LED_segments		PORTC
+#define LED_segments_DDR	DDRC
+///diody LED (aktywne stanem niskim)
+#define LED_PORT			PORTA
+#define LED_DDR				DDRA
+///przyciski (zwierane do masy, z podciąganiem)
+#define KEYS_PIN			PIND
+#define KEYS_PORT			PORTD
+#define KEYS_MASK			0x1F
+
+
+#if HAL_BACKEND == HAL_BACKEND_AVR
+	#define HAL_OUT( reg, val )		( ( reg ) = ( uint8_t ) ( val ) )
+	#define HAL_TIMER2_START( n )	do { OCR2 = ( uint8_t ) ( n ); TCNT2 = 0; TIFR = ( 1 << OCF2 ); } while( 0 )
+#elif HAL_BACKEND == HAL_BACKEND_HOST
+	#include "hal_host.h"
+	#define HAL_OUT( reg, val )		vHalHostOut( &( reg ), ( uint8_t ) ( val ) )
+	#define HAL_TIMER2_START( n )	vHalHostTimer2Start( ( uint8_t ) ( n ) )
+#else
+	#error "Nieznany HAL_BACKEND"
+#endif
+
+#define HAL_IN( reg )				( reg )
+
+
+///zapis całego portu cyfr wartością wyliczoną wcześniej (bez odczytu portu)
+#define HAL_DIGITS_WRITE( val )		HAL_OUT( LED_digits, val )
+///wartość portu segmentów dla seg (bit ustawiony = segment świeci)
+#define HAL_SEGMENTS_VALUE( seg )	( (uint8_t)~(seg) )
+///zapis portu segmentów wartością z HAL_SEGMENTS_VALUE
+#define HAL_SEGMENTS_WRITE( val )	HAL_OUT( LED_segments, val )
+///zapalenie diod LED z maski
+#define HAL_LEDS_ON( mask )			HAL_OUT( LED_PORT, LED_PORT & ~(mask) )
+///zgaszenie diod LED z maski
+#define HAL_LEDS_OFF( mask )		HAL_OUT( LED_PORT, LED_PORT | (mask) )
+///odczyt stanu przycisków (bit wyzerowany = przycisk wciśnięty)
+#define HAL_KEYS_READ()				( HAL_IN( KEYS_PIN ) & KEYS_MASK )
+
+/* Timer2 (tryb CTC) odmierza szczeliny czasowe magistrali 1-Wire (ow_engine.c).
+   HAL_TIMER2_START(n) zeruje licznik i zgłosi TIMER2_COMP_vect po n taktach. */
+
+
+#endif /* HAL_H_ */
@@ -0,0 +1,72 @@
+/*
+ * keypad.h
+ *
+ *  Obsługa przycisków KEYS_PIN (hal.h) w przerwaniu.
+ *
+ *  keypad_tick() wywoływane co KEYPAD_TICK_MS (przerwanie zegara systemowego)
+ *  odczytuje wszystkie przyciski naraz i eliminuje drgania styków licznikiem
+ *  pionowym: dwa bajty ct0/ct1 tworzą osobny 2-bitowy licznik dla każdego
+ *  bitu portu, stan przycisku zmienia się po 4 jednakowych odczytach.
+ *  Zmiany stanu, autorepetycja i długie naciśnięcie trafiają jako zdarzenia
+ *  do kolejki (xQueueSendFromISR), zadanie nie musi odpytywać portu.
+ */
+
+#ifndef KEYPAD_H_
+#define KEYPAD_H_
+
+#include <inttypes.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "hal.h"
+
+
+// odstęp wywołań keypad_tick() w ms
+#define KEYPAD_TICK_MS			2
+// czas trzymania przycisku do zdarzenia KEYPAD_LONG i pierwszego KEYPAD_REPEAT
+#define KEYPAD_LONG_MS			1000
+// autorepetycja z przyspieszeniem: odstęp od KEYPAD_REPEAT_FIRST_MS, każdy
+// kolejny krótszy o 1/8, aż do KEYPAD_REPEAT_MIN_MS
+#define KEYPAD_REPEAT_FIRST_MS	200
+#define KEYPAD_REPEAT_MIN_MS	40
+
+/* zdarzenie (element kolejki, 2 bajty):
+   bity 0-4   - przycisk, którego dotyczy (jeden bit z KEYS_MASK)
+   bity 5-7   - typ KEYPAD_*
+   bity 8-15  - KEYPAD_PRESS, KEYPAD_RELEASE: stan wszystkich przycisków po
+                zmianie (bit ustawiony = wciśnięty), KEYPAD_REPEAT: numer
+                powtórzenia od 1 (najwyżej 255), KEYPAD_LONG: 0 */
+typedef uint16_t keypad_event_t;
+
+#define KEYPAD_PRESS			0x20
+#define KEYPAD_RELEASE			0x40
+#define KEYPAD_REPEAT			0x60
+#define KEYPAD_LONG				0x80
+// typy 0xA0...0xE0 nie są używane - wolne dla zdarzeń aplikacji w tej samej kolejce
+
+#define KEYPAD_EVENT_KEY(e)		((uint8_t)(e) & KEYS_MASK)
+#define KEYPAD_EVENT_TYPE(e)	((uint8_t)(e) & 0xE0)
+#define KEYPAD_EVENT_KEYS(e)	((uint8_t)((e) >> 8))
+#define KEYPAD_EVENT_COUNT(e)	((uint8_t)((e) >> 8))
+
+
+/* queue - kolejka elementów keypad_event_t; repeat_mask - przyciski
+   z autorepetycją, long_mask - przyciski zgłaszające KEYPAD_LONG;
+   powtórzenia i długie naciśnięcie tylko przy jednym wciśniętym przycisku */
+void keypad_init( xQueueHandle queue, uint8_t repeat_mask, uint8_t long_mask );
+
+/* wywoływane w przerwaniu co KEYPAD_TICK_MS */
+void keypad_tick( signed portBASE_TYPE *woken );
+
+/* stan przycisków po eliminacji drgań (bit ustawiony = wciśnięty) */
+uint8_t keypad_state( void );
+
+/* 1, gdy żaden przycisk nie jest wciśnięty ani nie drga - keypad_tick() nie ma
+   nic do roboty i zegar systemowy może stanąć (configSLEEP_ALLOWED, uśpienie
+   bez ticków); wywoływane przy zablokowanych przerwaniach */
+uint8_t keypad_idle( void );
+
+
+
+#endif /* KEYPAD_H_ */
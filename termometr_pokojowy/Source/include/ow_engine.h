@@ -0,0 +1,75 @@
+/*
+ * ow_engine.h
+ *
+ *  Obsługa magistrali 1-Wire w przerwaniu Timer2 (tryb CTC).
+ *
+ *  Zamiast ow_reset()/ow_byte_wr(), które blokują przerwania na całą
+ *  szczelinę (ok. 61us na bit, ok. 960us na reset), zadanie zgłasza całą
+ *  transakcję: reset + MATCH ROM/SKIP ROM + komenda + zapis N bajtów +
+ *  odczyt M bajtów.  Przerwanie wykonuje ją krok po kroku, procesor jest
+ *  wolny pomiędzy szczelinami, a po zakończeniu zadanie dostaje semafor.
+ *
+ *  Przeszukiwanie magistrali (ow_rom_search) zostaje w onewire.c - wywołuje
+ *  się je raz, przed uruchomieniem schedulera.
+ */
+
+#ifndef OW_ENGINE_H_
+#define OW_ENGINE_H_
+
+#include <inttypes.h>
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+#include "onewire.h"
+
+
+// maksymalna liczba transakcji oczekujących w kolejce
+#define OW_ENGINE_QUEUE_LEN	2
+
+/* flagi transakcji */
+#define OW_TR_STRONG_PULLUP	0x01	// po ostatnim bajcie zasilanie pasożytnicze (ow_parasite_enable)
+#define OW_TR_NO_RESET		0x02	// dalszy ciąg poprzedniej transakcji: bez resetu,
+									// rom-code i komendy, same bajty wr/rd (co najmniej jeden)
+#define OW_TR_CRC			0x04	// odczytane bajty kończą się CRC8, sprawdzane w trakcie
+									// odbioru (crc8_update), błąd - OW_ENGINE_CRC_ERR
+#define OW_TR_FF_ABORT(n)	((n)<<4)	// przerwanie odczytu, gdy n pierwszych bajtów
+									// to 0xFF (nikt nie odpowiada) - OW_ENGINE_NO_DATA
+
+/* status transakcji */
+#define OW_ENGINE_OK		0x00
+#define OW_ENGINE_BUSY		0x01
+#define OW_ENGINE_CRC_ERR	0x02
+#define OW_ENGINE_NO_DATA	0x03
+// brak impulsu obecności lub zwarcie - OW_PRESENCE_ERR (onewire.h)
+
+
+typedef struct ow_transaction {
+	const uint8_t *id;			// rom-code, NULL = SKIP ROM
+	uint8_t command;
+	const uint8_t *wr;			// bajty wysyłane po komendzie
+	uint8_t wr_len;
+	uint8_t *rd;				// bajty odczytywane na końcu
+	uint8_t rd_len;
+	uint8_t flags;				// OW_TR_*
+	volatile uint8_t status;	// OW_ENGINE_*, OW_PRESENCE_ERR
+	xSemaphoreHandle done;		// podawany po zakończeniu, NULL = semafor silnika
+} ow_transaction_t;
+
+
+void ow_engine_init(void);
+
+/* zgłoszenie transakcji, bez czekania na jej wykonanie */
+void ow_engine_submit( ow_transaction_t *t );
+
+/* oczekiwanie na zakończenie zgłoszonej transakcji, zwraca status;
+   kilka transakcji z tym samym semaforem można zgłosić naraz i czekać na
+   nie po kolei */
+uint8_t ow_engine_wait( ow_transaction_t *t );
+
+/* zgłoszenie transakcji i oczekiwanie na jej zakończenie, zwraca status */
+uint8_t ow_engine_transfer( ow_transaction_t *t );
+
+
+
+#endif /* OW_ENGINE_H_ */
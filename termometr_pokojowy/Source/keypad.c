@@ -0,0 +1,98 @@
+/*
+ * keypad.c
+ *
+ *  Przyciski: eliminacja drgań licznikiem pionowym, autorepetycja
+ *  z przyspieszeniem, długie naciśnięcie; opis w keypad.h.
+ */
+#include <avr/io.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "hal.h"
+#include "keypad.h"
+
+
+#define KEYPAD_TICKS(ms)	((ms) / KEYPAD_TICK_MS)
+
+
+static xQueueHandle kp_queue;
+static uint8_t kp_repeat_mask, kp_long_mask;
+
+static uint8_t kp_state;			// stan po eliminacji drgań, bit ustawiony = wciśnięty
+static uint8_t kp_ct0 = 0xFF, kp_ct1 = 0xFF;	// licznik pionowy, osobny dla każdego bitu
+static uint16_t kp_wait;			// takty do następnego KEYPAD_LONG/KEYPAD_REPEAT, 0 = brak
+static uint8_t kp_interval;			// bieżący odstęp autorepetycji w taktach
+static uint8_t kp_count;			// numer ostatniego powtórzenia
+
+
+
+void keypad_init( xQueueHandle queue, uint8_t repeat_mask, uint8_t long_mask )
+{
+	kp_queue = queue;
+	kp_repeat_mask = repeat_mask;
+	kp_long_mask = long_mask;
+}
+
+
+uint8_t keypad_state( void )
+{
+	return kp_state;
+}
+
+
+uint8_t keypad_idle( void )
+{
+	// liczniki drgań nie trzeba sprawdzać: przy takim odczycie keypad_tick() i tak je zeruje
+	return kp_state == 0 && ((~HAL_KEYS_READ()) & KEYS_MASK) == 0;
+}
+
+
+static void kp_send( uint8_t type, uint8_t key, uint8_t arg, signed portBASE_TYPE *woken )
+{
+	keypad_event_t e = (keypad_event_t)(type | key) | ((keypad_event_t)arg << 8);
+
+	// pełna kolejka - zdarzenie ginie, zadanie i tak ma co obsługiwać
+	xQueueSendFromISR( kp_queue, &e, woken );
+}
+
+
+void keypad_tick( signed portBASE_TYPE *woken )
+{
+	uint8_t i, key;
+
+	// bity, w których odczyt różni się od stanu ustalonego, liczą w górę,
+	// pozostałe są zerowane; po 4 odczytach (przepełnienie) stan się zmienia
+	i = kp_state ^ ((~HAL_KEYS_READ()) & KEYS_MASK);
+	kp_ct0 = ~(kp_ct0 & i);
+	kp_ct1 = kp_ct0 ^ (kp_ct1 & i);
+	i &= kp_ct0 & kp_ct1;
+	kp_state ^= i;
+
+	if( i ) {
+		// zdarzenie dla każdego zmienionego przycisku, od najmłodszego bitu
+		while( i ) {
+			key = i & (uint8_t)(-i);
+			i &= ~key;
+			kp_send( (kp_state & key) ? KEYPAD_PRESS : KEYPAD_RELEASE, key, kp_state, woken );
+		}
+		kp_wait = KEYPAD_TICKS(KEYPAD_LONG_MS);
+		kp_interval = KEYPAD_TICKS(KEYPAD_REPEAT_FIRST_MS);
+		kp_count = 0;
+		return;
+	}
+
+	// długie naciśnięcie i powtórzenia - tylko przy jednym wciśniętym przycisku
+	if( kp_state == 0 || (kp_state & (kp_state - 1)) || kp_wait == 0 || --kp_wait ) return;
+
+	if( kp_count == 0 && (kp_state & kp_long_mask) )
+		kp_send( KEYPAD_LONG, kp_state, 0, woken );
+
+	if( kp_state & kp_repeat_mask ) {
+		if( kp_count < 255 ) kp_count++;
+		kp_send( KEYPAD_REPEAT, kp_state, kp_count, woken );
+		kp_wait = kp_interval;
+		kp_interval -= kp_interval >> 3;
+		if( kp_interval < KEYPAD_TICKS(KEYPAD_REPEAT_MIN_MS) ) kp_interval = KEYPAD_TICKS(KEYPAD_REPEAT_MIN_MS);
+	}
+}
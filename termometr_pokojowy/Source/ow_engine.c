@@ -0,0 +1,388 @@
+/*
+ * ow_engine.c
+ *
+ *  Transakcje 1-Wire wykonywane w przerwaniu Timer2, opis w ow_engine.h.
+ *
+ *  OW_BACKEND_PIN: Timer2 pracuje w trybie CTC z preskalerem 32 (2us na takt
+ *  przy 16MHz), każde przerwanie kończy jeden etap: impuls resetu,
+ *  oczekiwanie na impuls obecności, koniec resetu albo szczelinę bitu.
+ *  Przerwania są zablokowane tylko na początku szczeliny (ok. 15us, do
+ *  próbkowania linii), reszta szczeliny i cały reset odmierzane są przez
+ *  licznik.
+ *
+ *  OW_BACKEND_UART: reset i szczeliny wytwarza USART (onewire.h), przerwanie
+ *  odbioru ramki (USART_RXC_vect) odbiera wynik i wysyła następną ramkę.
+ */
+#include <avr/io.h>
+#include <util/delay.h>
+#include <avr/interrupt.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+#include "hal.h"
+#include "onewire.h"
+#include "crc8.h"
+#include "ow_engine.h"
+
+
+#if OW_BACKEND == OW_BACKEND_PIN
+// te same operacje na linii co w onewire.c
+#define OW_GET_IN()   ( HAL_IN(OW_IN) & (1<<OW_PIN))
+#define OW_OUT_LOW()  HAL_OUT( OW_OUT, OW_OUT & (~(1 << OW_PIN)) )
+#define OW_DIR_IN()   HAL_OUT( OW_DDR, OW_DDR & (~(1 << OW_PIN )) )
+#define OW_DIR_OUT()  HAL_OUT( OW_DDR, OW_DDR | (1 << OW_PIN) )
+
+// czas w us na takty Timer2 (preskaler 32), maksymalnie 510us
+#define OW_T(us)      ((uint8_t)((us)*(F_CPU/1000000UL)/32))
+#endif
+
+/* etapy transakcji - kolejne przerwania Timer2 */
+#define OW_PHASE_IDLE		0	// kolejka pusta, przerwanie wyłączone
+#define OW_PHASE_START		1	// przerwa przed następną transakcją
+#define OW_PHASE_RESET		2	// koniec impulsu resetu (USART: odebrana ramka resetu)
+#define OW_PHASE_PRESENCE	3	// próbkowanie impulsu obecności
+#define OW_PHASE_RECOVERY	4	// koniec resetu, kontrola zwarcia
+#define OW_PHASE_SLOT		5	// koniec szczeliny bitu
+
+// MATCH ROM + 8 bajtów rom-code + komenda
+#define OW_HEADER_SIZE		(1 + OW_ROMCODE_SIZE + 1)
+
+
+static xQueueHandle ow_queue;
+static xSemaphoreHandle ow_done;
+
+static ow_transaction_t *ow_cur;
+static volatile uint8_t ow_phase;
+
+static uint8_t ow_header[OW_HEADER_SIZE];
+static uint8_t ow_header_len;
+static uint8_t ow_pos;			// numer bieżącego bajtu transakcji
+static uint8_t ow_len;			// liczba bajtów transakcji
+static uint8_t ow_byte;			// bajt w trakcie wysyłania/odbioru
+static uint8_t ow_bits;			// bity pozostałe w bajcie
+static uint8_t ow_crc;			// CRC odczytanych bajtów (OW_TR_CRC)
+static uint8_t ow_ff;			// liczba początkowych bajtów 0xFF (OW_TR_FF_ABORT)
+
+
+
+void ow_engine_init(void)
+{
+	ow_queue = xQueueCreate( OW_ENGINE_QUEUE_LEN, sizeof( ow_transaction_t * ) );
+	vSemaphoreCreateBinary( ow_done );
+	xSemaphoreTake( ow_done, 0 );
+
+	ow_phase = OW_PHASE_IDLE;
+
+#if OW_BACKEND == OW_BACKEND_PIN
+	// Timer2: tryb CTC, preskaler 32, przerwanie włączane przy zgłoszeniu
+	TIMSK &= ~(1<<OCIE2);
+	TCCR2 = (1<<WGM21) | (0<<CS22) | (1<<CS21) | (1<<CS20);
+#endif
+}
+
+
+/* kolejny bajt transakcji: nagłówek, bajty do zapisu, 0xFF przy odczycie */
+static uint8_t ow_next_byte(void)
+{
+	uint8_t i = ow_pos;
+
+	if( i < ow_header_len ) return ow_header[i];
+	i -= ow_header_len;
+	if( i < ow_cur->wr_len ) return ow_cur->wr[i];
+	return 0xFF;
+}
+
+
+#if OW_BACKEND == OW_BACKEND_PIN
+
+/* początek szczeliny dla najmłodszego bitu ow_byte, jak w ow_bit_io(),
+   koniec szczeliny (zwolnienie linii) w następnym przerwaniu */
+static void ow_slot(void)
+{
+	uint8_t b = ow_byte & 1;
+
+	HAL_TIMER2_START( OW_T(60) );
+	_delay_us(1); // recovery po poprzedniej szczelinie
+
+	OW_DIR_OUT(); // drive bus low
+
+	_delay_us(1);
+	if ( b ) OW_DIR_IN(); // if bit is 1 set bus high (by ext. pull-up)
+
+	_delay_us(12);
+
+	if( OW_GET_IN() == 0 ) b = 0;  // sample at end of read-timeslot
+
+	ow_byte >>= 1;
+	if( b ) ow_byte |= 0x80;
+}
+
+/* reset na początku transakcji */
+static void ow_bus_reset(void)
+{
+	TIMSK |= (1<<OCIE2);
+	OW_OUT_LOW(); // disable internal pull-up (maybe on from parasite)
+	OW_DIR_OUT(); // pull OW-Pin low for 480us
+	HAL_TIMER2_START( OW_T(480) );
+}
+
+/* szczeliny bez resetu (OW_TR_NO_RESET) */
+static void ow_bus_continue(void)
+{
+	TIMSK |= (1<<OCIE2);
+}
+
+static void ow_bus_idle(void)
+{
+	TIMSK &= ~(1<<OCIE2);
+}
+
+#else
+
+/* szczelina dla najmłodszego bitu ow_byte, wynik w USART_RXC_vect */
+static void ow_slot(void)
+{
+	HAL_OUT( UDR, (ow_byte & 1) ? 0xFF : 0x00 );
+}
+
+static void ow_bus_reset(void)
+{
+	UCSRB = (1<<RXCIE) | (1<<RXEN) | (1<<TXEN);
+	UCSRA = (1<<U2X);
+	UBRRH = 0;
+	UBRRL = OW_UART_UBRR(OW_UART_RESET_BAUD);
+	HAL_OUT( UDR, 0xF0 );
+}
+
+static void ow_bus_continue(void)
+{
+	UCSRB = (1<<RXCIE) | (1<<RXEN) | (1<<TXEN);
+	UCSRA = (1<<U2X);
+	UBRRH = 0;
+	UBRRL = OW_UART_UBRR(OW_UART_SLOT_BAUD);
+}
+
+static void ow_bus_idle(void)
+{
+	UCSRB &= ~(1<<RXCIE);
+}
+
+#endif /* OW_BACKEND */
+
+
+static void ow_start_byte(void)
+{
+	ow_byte = ow_next_byte();
+	ow_bits = 8;
+	ow_slot();
+}
+
+
+/* pobranie następnej transakcji z kolejki i reset magistrali, wywoływane
+   w przerwaniu lub w sekcji krytycznej */
+static void ow_start_next( signed portBASE_TYPE *woken )
+{
+	ow_transaction_t *t;
+	uint8_t i;
+
+	if( xQueueReceiveFromISR( ow_queue, &t, woken ) != pdTRUE ) {
+		ow_bus_idle();
+		ow_phase = OW_PHASE_IDLE;
+		return;
+	}
+
+	ow_cur = t;
+	ow_header_len = 0;
+	ow_pos = 0;
+	ow_crc = CRC8INIT;
+	ow_ff = 0;
+
+	if( t->flags & OW_TR_NO_RESET ) {
+		ow_len = t->wr_len + t->rd_len;
+		ow_phase = OW_PHASE_SLOT;
+		ow_bus_continue();
+		ow_start_byte();
+		return;
+	}
+
+	if( t->id ) {
+		ow_header[ow_header_len++] = OW_MATCH_ROM;
+		for( i = 0; i < OW_ROMCODE_SIZE; i++ ) ow_header[ow_header_len++] = t->id[i];
+	}
+	else {
+		ow_header[ow_header_len++] = OW_SKIP_ROM;
+	}
+	ow_header[ow_header_len++] = t->command;
+
+	ow_len = ow_header_len + t->wr_len + t->rd_len;
+
+	ow_phase = OW_PHASE_RESET;
+	ow_bus_reset();
+}
+
+
+/* koniec transakcji, potem kolejna z kolejki */
+static void ow_finish( uint8_t status, signed portBASE_TYPE *woken )
+{
+	ow_cur->status = status;
+	xSemaphoreGiveFromISR( ow_cur->done ? ow_cur->done : ow_done, woken );
+
+#if OW_BACKEND == OW_BACKEND_PIN
+	if( status == OW_ENGINE_OK && (ow_cur->flags & OW_TR_STRONG_PULLUP) )
+		ow_parasite_enable();
+
+	ow_phase = OW_PHASE_START;
+	HAL_TIMER2_START( OW_T(10) );
+#else
+	ow_start_next( woken );
+#endif
+}
+
+
+/* koniec szczeliny: następny bit, następny bajt albo koniec transakcji */
+static void ow_bit_done( signed portBASE_TYPE *woken )
+{
+	uint8_t i;
+
+	if( --ow_bits ) {
+		ow_slot();
+		return;
+	}
+	i = ow_pos - ow_header_len - ow_cur->wr_len;
+	if( i < ow_cur->rd_len ) {
+		ow_cur->rd[i] = ow_byte;
+		ow_crc = crc8_update( ow_crc, ow_byte );
+		// same 0xFF od początku - linia nie jest ściągana, urządzenie nie odpowiada
+		if( ow_ff == i && ow_byte == 0xFF && ++ow_ff == (ow_cur->flags >> 4) ) {
+			ow_finish( OW_ENGINE_NO_DATA, woken );
+			return;
+		}
+	}
+	if( ++ow_pos < ow_len ) ow_start_byte();
+	else if( (ow_cur->flags & OW_TR_CRC) && ow_crc ) ow_finish( OW_ENGINE_CRC_ERR, woken );
+	else ow_finish( OW_ENGINE_OK, woken );
+}
+
+
+#if OW_BACKEND == OW_BACKEND_PIN
+
+ISR(TIMER2_COMP_vect)
+{
+	signed portBASE_TYPE woken = pdFALSE;
+
+	switch( ow_phase ) {
+	case OW_PHASE_START:
+		ow_start_next( &woken );
+		break;
+
+	case OW_PHASE_RESET:
+		OW_DIR_IN(); // wait for clients to pull low
+		HAL_TIMER2_START( OW_T(66) );
+		ow_phase = OW_PHASE_PRESENCE;
+		break;
+
+	case OW_PHASE_PRESENCE:
+		if( OW_GET_IN() ) {		// no presence detect
+			ow_finish( OW_PRESENCE_ERR, &woken );
+		}
+		else {
+			HAL_TIMER2_START( OW_T(480-66) );
+			ow_phase = OW_PHASE_RECOVERY;
+		}
+		break;
+
+	case OW_PHASE_RECOVERY:
+		if( OW_GET_IN() == 0 ) {	// short circuit
+			ow_finish( OW_PRESENCE_ERR, &woken );
+		}
+		else {
+			ow_phase = OW_PHASE_SLOT;
+			ow_start_byte();
+		}
+		break;
+
+	case OW_PHASE_SLOT:
+		OW_DIR_IN(); // end of the previous slot
+		ow_bit_done( &woken );
+		break;
+
+	default:
+		ow_bus_idle();
+		break;
+	}
+
+	if (woken == pdTRUE) taskYIELD();
+}
+
+#else
+
+ISR(USART_RXC_vect)
+{
+	signed portBASE_TYPE woken = pdFALSE;
+	uint8_t r = UDR;
+
+	switch( ow_phase ) {
+	case OW_PHASE_RESET:
+		UBRRL = OW_UART_UBRR(OW_UART_SLOT_BAUD);
+		if( r == 0xF0 || r == 0x00 ) {	// no presence detect / short circuit
+			ow_finish( OW_PRESENCE_ERR, &woken );
+		}
+		else {
+			ow_phase = OW_PHASE_SLOT;
+			ow_start_byte();
+		}
+		break;
+
+	case OW_PHASE_SLOT:
+		ow_byte >>= 1;
+		if( r == 0xFF ) ow_byte |= 0x80;
+		ow_bit_done( &woken );
+		break;
+
+	default:
+		ow_bus_idle();
+		break;
+	}
+
+	if (woken == pdTRUE) taskYIELD();
+}
+
+#endif /* OW_BACKEND */
+
+
+void ow_engine_submit( ow_transaction_t *t )
+{
+	signed portBASE_TYPE woken = pdFALSE;
+
+	t->status = OW_ENGINE_BUSY;
+	xQueueSend( ow_queue, &t, portMAX_DELAY );
+
+	portENTER_CRITICAL();
+	if( ow_phase == OW_PHASE_IDLE ) {
+		// przełączenie zadania (jeśli potrzebne) przy najbliższym wywołaniu schedulera
+		ow_start_next( &woken );
+	}
+	portEXIT_CRITICAL();
+}
+
+
+uint8_t ow_engine_wait( ow_transaction_t *t )
+{
+	xSemaphoreHandle done = t->done ? t->done : ow_done;
+
+	// semafor binarny zlicza najwyżej jedno zakończenie - decyduje status
+	while( t->status == OW_ENGINE_BUSY )
+		xSemaphoreTake( done, portMAX_DELAY );
+
+	return t->status;
+}
+
+
+uint8_t ow_engine_transfer( ow_transaction_t *t )
+{
+	ow_engine_submit( t );
+	return ow_engine_wait( t );
+}
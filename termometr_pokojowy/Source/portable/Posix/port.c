@@ -0,0 +1,507 @@
+/*
+    FreeRTOS V7.0.2 - Copyright (C) 2011 Real Time Engineers Ltd.
+	
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS tutorial books are available in pdf and paperback.        *
+     *    Complete, revised, and edited pdf reference manuals are also       *
+     *    available.                                                         *
+     *                                                                       *
+     *    Purchasing FreeRTOS documentation will not only help you, by       *
+     *    ensuring you get running as quickly as possible and with an        *
+     *    in-depth knowledge of how to use FreeRTOS, it will also help       *
+     *    the FreeRTOS project to continue with its mission of providing     *
+     *    professional grade, cross platform, de facto standard solutions    *
+     *    for microcontrollers - completely free of charge!                  *
+     *                                                                       *
+     *    >>> See http://www.FreeRTOS.org/Documentation for details. <<<     *
+     *                                                                       *
+     *    Thank you for using FreeRTOS, and thank you for your support!      *
+     *                                                                       *
+    ***************************************************************************
+
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation AND MODIFIED BY the FreeRTOS exception.
+    >>>NOTE<<< The modification to the GPL is included to allow you to
+    distribute a combined work that includes FreeRTOS without being obliged to
+    provide the source code for proprietary components outside of the FreeRTOS
+    kernel.  FreeRTOS is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+    or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+    more details. You should have received a copy of the GNU General Public
+    License and the FreeRTOS license exception along with FreeRTOS; if not it
+    can be viewed here: http://www.freertos.org/a00114.html and also obtained
+    by writing to Richard Barry, contact details for whom are available on the
+    FreeRTOS WEB site.
+
+    1 tab == 4 spaces!
+
+    http://www.FreeRTOS.org - Documentation, latest information, license and
+    contact details.
+
+    http://www.SafeRTOS.com - A version that is certified for use in safety
+    critical systems.
+
+    http://www.OpenRTOS.com - Commercial support, development, porting,
+    licensing and training services.
+*/
+
+/*
+	Host (POSIX) variant of the ATmega32 port, see portmacro.h.
+
+	Every task runs on its own ucontext with a host sized stack.  Where the
+	AVR port saves the 32 registers and SREG on the task stack, this port
+	saves the host context with swapcontext() and keeps SREG and the critical
+	nesting depth in the frame of the function doing the switch.  The tick
+	comes from the simulated timer 1 compare match A, set up exactly as on the
+	target, and is dispatched by Host/avrsim.c.
+*/
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the host port.
+ *----------------------------------------------------------*/
+
+/* Start tasks with interrupts enables. */
+#define portFLAGS_INT_ENABLED					( ( unsigned char ) 0x80 )
+
+/* Hardware constants for timer 1. */
+#define portCLEAR_COUNTER_ON_MATCH				( ( unsigned char ) 0x08 )
+#define portPRESCALE_64							( ( unsigned char ) 0x03 )
+#define portCLOCK_PRESCALER						( ( unsigned long ) 64 )
+#define portCOMPARE_MATCH_A_INTERRUPT_ENABLE	( ( unsigned char ) 0x10 )
+#define portCOMPARE_MATCH_B_INTERRUPT_ENABLE	( ( unsigned char ) 0x08 )
+#define portCOMPARE_MATCH_A_FLAG				( ( unsigned char ) 0x10 )
+#define portCOMPARE_MATCH_B_FLAG				( ( unsigned char ) 0x08 )
+
+/* Timer 1 counts in one tick period, and the longest idle period the 16 bit
+counter can span. */
+#define portTICK_COUNTS							( configCPU_CLOCK_HZ / configTICK_RATE_HZ / portCLOCK_PRESCALER )
+#define portMAX_SUPPRESSED_TICKS				( ( portTickType ) ( 0x10000UL / portTICK_COUNTS ) )
+
+/*-----------------------------------------------------------*/
+
+/* We require the address of the pxCurrentTCB variable, but don't want to know
+any details of its type. */
+typedef void tskTCB;
+extern volatile tskTCB * volatile pxCurrentTCB;
+
+/* Host context of a task.  The stack the task runs on follows the structure
+in the same allocation. */
+typedef struct xTASK_CONTEXT
+{
+	ucontext_t xContext;
+	pdTASK_CODE pxCode;
+	void *pvParameters;
+} xTaskContext;
+
+/* Critical section nesting of the running task and the SREG value to restore
+when it leaves the outermost critical section. */
+static unsigned portBASE_TYPE uxCriticalNesting = 0;
+static unsigned char ucCriticalSREG = 0;
+
+/* Context that called xPortStartScheduler(), resumed by vPortEndScheduler(). */
+static ucontext_t xSchedulerContext;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Perform hardware setup to enable ticks from timer 1, compare match A.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * Host context of the task pxCurrentTCB refers to.
+ */
+static xTaskContext *prvCurrentContext( void );
+
+/*
+ * Select the next task and switch to it.  Equivalent of the code between
+ * portSAVE_CONTEXT() and portRESTORE_CONTEXT() in the AVR port, called with
+ * interrupts disabled.
+ */
+static void prvSwitchContext( void );
+
+/*
+ * First function executed by every task.
+ */
+static void prvTaskEntry( void );
+/*-----------------------------------------------------------*/
+
+/* 
+ * See header file for description. 
+ */
+portSTACK_TYPE *pxPortInitialiseStack( portSTACK_TYPE *pxTopOfStack, pdTASK_CODE pxCode, void *pvParameters )
+{
+xTaskContext *pxContext;
+
+	pxContext = ( xTaskContext * ) malloc( sizeof( xTaskContext ) + portHOST_STACK_SIZE );
+	if( pxContext == NULL )
+	{
+		abort();
+	}
+
+	pxContext->pxCode = pxCode;
+	pxContext->pvParameters = pvParameters;
+
+	getcontext( &( pxContext->xContext ) );
+	pxContext->xContext.uc_stack.ss_sp = ( void * ) ( pxContext + 1 );
+	pxContext->xContext.uc_stack.ss_size = portHOST_STACK_SIZE;
+	pxContext->xContext.uc_link = NULL;
+	sigemptyset( &( pxContext->xContext.uc_sigmask ) );
+	makecontext( &( pxContext->xContext ), prvTaskEntry, 0 );
+
+	/* Where the AVR port builds the initial register frame keep a reference
+	to the host context instead.  The top of stack stays aligned. */
+	pxTopOfStack -= sizeof( xTaskContext * );
+	memcpy( pxTopOfStack + 1, &pxContext, sizeof( xTaskContext * ) );
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static xTaskContext *prvCurrentContext( void )
+{
+portSTACK_TYPE *pxTopOfStack;
+xTaskContext *pxContext;
+
+	/* pxTopOfStack is the first member of the TCB. */
+	pxTopOfStack = *( portSTACK_TYPE ** ) pxCurrentTCB;
+	memcpy( &pxContext, pxTopOfStack + 1, sizeof( xTaskContext * ) );
+
+	return pxContext;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+xTaskContext *pxContext = prvCurrentContext();
+
+	/* As on the target the task starts outside of any critical section with
+	interrupts enabled. */
+	uxCriticalNesting = 0;
+	sei();
+
+	pxContext->pxCode( pxContext->pvParameters );
+
+	/* Task functions must never return. */
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+xTaskContext *pxOldContext, *pxNewContext;
+unsigned portBASE_TYPE uxSavedNesting = uxCriticalNesting;
+unsigned char ucSavedCriticalSREG = ucCriticalSREG;
+
+	pxOldContext = prvCurrentContext();
+	vTaskSwitchContext();
+	pxNewContext = prvCurrentContext();
+
+	if( pxNewContext != pxOldContext )
+	{
+		swapcontext( &( pxOldContext->xContext ), &( pxNewContext->xContext ) );
+	}
+
+	/* The task has been selected again. */
+	uxCriticalNesting = uxSavedNesting;
+	ucCriticalSREG = ucSavedCriticalSREG;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortStartScheduler( void )
+{
+	/* Setup the hardware to generate the tick. */
+	prvSetupTimerInterrupt();
+
+	/* Start the first task.  vPortEndScheduler() returns here. */
+	swapcontext( &xSchedulerContext, &( prvCurrentContext()->xContext ) );
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	/* Stop the tick and return to the context xPortStartScheduler() was
+	called from, so a host program can inspect the state afterwards. */
+	TIMSK &= ( unsigned char ) ~portCOMPARE_MATCH_A_INTERRUPT_ENABLE;
+	setcontext( &xSchedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+unsigned char ucSREG = SREG;
+
+	cli();
+
+	if( uxCriticalNesting == 0 )
+	{
+		ucCriticalSREG = ucSREG;
+	}
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	uxCriticalNesting--;
+
+	if( ( uxCriticalNesting == 0 ) && ( ( ucCriticalSREG & portFLAGS_INT_ENABLED ) != 0 ) )
+	{
+		sei();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Manual context switch.  SREG is saved and interrupts disabled first, as
+ * portSAVE_CONTEXT() does.
+ */
+void vPortYield( void )
+{
+unsigned char ucSREG = SREG;
+
+	cli();
+	prvSwitchContext();
+
+	if( ( ucSREG & portFLAGS_INT_ENABLED ) != 0 )
+	{
+		sei();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Context switch function used by the tick.  The only difference from
+ * vPortYield() is the tick count is incremented as the call comes from the
+ * tick ISR.
+ */
+void vPortYieldFromTick( void );
+void vPortYieldFromTick( void )
+{
+unsigned char ucSREG = SREG;
+
+	cli();
+	vTaskIncrementTick();
+	prvSwitchContext();
+
+	if( ( ucSREG & portFLAGS_INT_ENABLED ) != 0 )
+	{
+		sei();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup timer 1 compare match A to generate a tick interrupt.
+ */
+static void prvSetupTimerInterrupt( void )
+{
+unsigned long ulCompareMatch;
+unsigned char ucHighByte, ucLowByte;
+
+	/* Using 16bit timer 1 to generate the tick.  Correct fuses must be
+	selected for the configCPU_CLOCK_HZ clock. */
+
+	ulCompareMatch = configCPU_CLOCK_HZ / configTICK_RATE_HZ;
+
+	/* We only have 16 bits so have to scale to get our required tick rate. */
+	ulCompareMatch /= portCLOCK_PRESCALER;
+
+	/* Adjust for correct value. */
+	ulCompareMatch -= ( unsigned long ) 1;
+
+	/* Setup compare match value for compare match A.  Interrupts are disabled 
+	before this is called so we need not worry here. */
+	ucLowByte = ( unsigned char ) ( ulCompareMatch & ( unsigned long ) 0xff );
+	ulCompareMatch >>= 8;
+	ucHighByte = ( unsigned char ) ( ulCompareMatch & ( unsigned long ) 0xff );
+	OCR1AH = ucHighByte;
+	OCR1AL = ucLowByte;
+
+	/* Setup clock source and compare match behaviour. */
+	ucLowByte = portCLEAR_COUNTER_ON_MATCH | portPRESCALE_64;
+	TCCR1B = ucLowByte;
+
+	/* Enable the interrupt - this is okay as interrupt are currently globally
+	disabled. */
+	ucLowByte = TIMSK;
+	ucLowByte |= portCOMPARE_MATCH_A_INTERRUPT_ENABLE;
+	TIMSK = ucLowByte;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+
+	#if configEXPECTED_IDLE_TIME_BEFORE_SLEEP < 2
+		#error configEXPECTED_IDLE_TIME_BEFORE_SLEEP must be at least 2, the stretched period has to end after the tick being counted now
+	#endif
+
+	/* Tick periods not stretched because the tick ended just before, see
+	ulPortTicklessWindowHits(). */
+	static unsigned long ulTicklessWindowHits = 0;
+
+	/*
+	 * Stop the tick for an idle period and sleep, as in the AVR port.  The
+	 * simulated timer 1 is brought up to date before its counter is read, and
+	 * timer flags are cleared through the simulator (TIFR is not write one to
+	 * clear here).
+	 */
+	void vPortSuppressTicksAndSleep( portTickType xExpectedIdleTime )
+	{
+	unsigned short usCount, usRemainder;
+
+		if( xExpectedIdleTime > portMAX_SUPPRESSED_TICKS )
+		{
+			xExpectedIdleTime = portMAX_SUPPRESSED_TICKS;
+		}
+
+		portDISABLE_INTERRUPTS();
+
+		/* A tick already pending, a task made ready since the idle time was
+		calculated or the application needing the tick - do not sleep. */
+		vAvrSimSyncTimers();
+		if( ( ( TIFR & portCOMPARE_MATCH_A_FLAG ) != 0 ) || ( eTaskConfirmSleepModeStatus() == eAbortSleep ) || !configSLEEP_ALLOWED() )
+		{
+			portENABLE_INTERRUPTS();
+			return;
+		}
+
+		/* The window between the test and the write, a few cycles on the
+		target, can be widened to make the tick end inside it. */
+		#if ( portTICKLESS_WINDOW_US > 0 )
+			vAvrSimDelayUs( portTICKLESS_WINDOW_US );
+		#endif
+
+		/* Stretch the current tick period over the whole idle time.  Timer 1
+		is brought up to date on both sides of the write, so a tick that ends
+		before it does so with the old TOP. */
+		vAvrSimSyncTimers();
+		OCR1A = ( unsigned short ) ( ( unsigned long ) xExpectedIdleTime * portTICK_COUNTS - 1UL );
+		OCR1B = OCR1A;
+		vAvrSimSyncTimers();
+
+		/* The tick ended before the write, see the AVR port. */
+		if( ( TIFR & portCOMPARE_MATCH_A_FLAG ) != 0 )
+		{
+			OCR1A = ( unsigned short ) ( portTICK_COUNTS - 1UL );
+			ulTicklessWindowHits++;
+			portENABLE_INTERRUPTS();
+			return;
+		}
+
+		vAvrSimClearTimerFlags( portCOMPARE_MATCH_B_FLAG );
+		TIMSK = ( unsigned char ) ( ( TIMSK & ( unsigned char ) ~portCOMPARE_MATCH_A_INTERRUPT_ENABLE ) | portCOMPARE_MATCH_B_INTERRUPT_ENABLE );
+
+		set_sleep_mode( SLEEP_MODE_IDLE );
+		for( ;; )
+		{
+			sleep_enable();
+			portENABLE_INTERRUPTS();
+			sleep_cpu();
+			sleep_disable();
+			portDISABLE_INTERRUPTS();
+
+			if( ( TIFR & portCOMPARE_MATCH_A_FLAG ) != 0 )
+			{
+				break;
+			}
+
+			if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) || !configSLEEP_ALLOWED() )
+			{
+				break;
+			}
+		}
+
+		TIMSK = ( unsigned char ) ( ( TIMSK & ( unsigned char ) ~portCOMPARE_MATCH_B_INTERRUPT_ENABLE ) | portCOMPARE_MATCH_A_INTERRUPT_ENABLE );
+		vAvrSimSyncTimers();
+		usCount = TCNT1;
+
+		if( ( TIFR & portCOMPARE_MATCH_A_FLAG ) != 0 )
+		{
+			/* The last tick of the period is left to the pending tick
+			interrupt.  A counter still at the old TOP is cleared here. */
+			if( usCount >= portTICK_COUNTS )
+			{
+				TCNT1 = 0;
+			}
+			OCR1A = ( unsigned short ) ( portTICK_COUNTS - 1UL );
+			vTaskStepTick( xExpectedIdleTime - ( portTickType ) 1 );
+		}
+		else
+		{
+			/* Woken early, continue the current tick; the counter is not
+			restored to TOP, see the AVR port. */
+			vAvrSimClearTimerFlags( portCOMPARE_MATCH_A_FLAG );
+			usRemainder = ( unsigned short ) ( usCount % portTICK_COUNTS );
+			if( usRemainder > ( unsigned short ) ( portTICK_COUNTS - 2UL ) )
+			{
+				usRemainder = ( unsigned short ) ( portTICK_COUNTS - 2UL );
+			}
+			TCNT1 = usRemainder;
+			OCR1A = ( unsigned short ) ( portTICK_COUNTS - 1UL );
+			vTaskStepTick( ( portTickType ) ( usCount / portTICK_COUNTS ) );
+		}
+
+		portENABLE_INTERRUPTS();
+	}
+	/*-----------------------------------------------------------*/
+
+	unsigned long ulPortTicklessWindowHits( void )
+	{
+		return ulTicklessWindowHits;
+	}
+	/*-----------------------------------------------------------*/
+
+	/*
+	 * End of a suppressed tick period, only wakes the CPU from sleep.
+	 */
+	void TIMER1_COMPB_vect( void );
+	void TIMER1_COMPB_vect( void )
+	{
+	}
+	/*-----------------------------------------------------------*/
+
+#endif
+
+#if configUSE_PREEMPTION == 1
+
+	/*
+	 * Tick ISR for preemptive scheduler.  The context switch, if any, is
+	 * performed by vPortYieldFromTick().
+	 */
+	void TIMER1_COMPA_vect( void );
+	void TIMER1_COMPA_vect( void )
+	{
+		vPortYieldFromTick();
+	}
+#else
+
+	/*
+	 * Tick ISR for the cooperative scheduler.  All this does is increment the
+	 * tick count.  We don't need to switch context, this can only be done by
+	 * manual calls to taskYIELD();
+	 */
+	void TIMER1_COMPA_vect( void );
+	void TIMER1_COMPA_vect( void )
+	{
+		vTaskIncrementTick();
+	}
+#endif
@@ -0,0 +1,460 @@
+/*
+ * cyclecheck.c
+ *
+ * Runs the target build (termometr.elf) on a simulated ATmega32 (simavr) and
+ * counts the cycles spent in the context switch functions of the AVR port and
+ * in the display interrupt ("make cycles", see Makefile).
+ *
+ *   cyclecheck <elf> <ms> [display=<vector>:<ptr>:<off_phase>:<digits>:<max>]
+ *              <function>=<address>:<size>:<cycles>[,<cycles>...] ...
+ *
+ * Every function is given by its address and size in bytes, as avr-nm -S
+ * prints them.  A call starts at the first instruction of the function and
+ * ends with its ret; the cycles of the instructions executed inside the
+ * function between the two are added up, except those of the calls out of it
+ * (call, rcall - the kernel functions called are not counted) and of the ret
+ * itself.  That leaves the register save and restore of vPortYield() and
+ * vPortYieldFromTick().  Every call must take one of the cycle counts given,
+ * else the check fails.  A call during which the simulator took an interrupt
+ * before the interrupts were disabled is not checked, only counted.
+ *
+ * The display interrupt (display.c) is timed from the jmp in the vector table
+ * to its reti, both included, with everything called in between; the four
+ * cycles of the interrupt response come on top.  Its path is told from the
+ * state of display.c at the jmp, read from the RAM addresses of ptr and
+ * off_phase (avr-nm): "off" ends a dimmed digit (off_phase set), "frame"
+ * moves to the first digit and runs display_frame_start() (ptr at the last of
+ * <digits>), "slot" moves to any other digit.  The minimum and maximum of each
+ * path are printed; the check fails if one interrupt takes more than <max>
+ * cycles or if the slot or frame path never ran.
+ *
+ * The firmware runs without sensors or keys: the tasks run, block and are
+ * switched the usual way, which is all the check needs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+
+#define cycleMCU				"atmega32"
+#define cycleF_CPU				16000000UL
+
+/* 21 vectors of two words: a program counter below this has just been set to
+an interrupt vector. */
+#define cycleVECTORS_END		( 21U * 4U )
+
+#define cycleMAX_FUNCTIONS		4
+#define cycleMAX_EXPECTED		4
+#define cycleMAX_HISTOGRAM		16
+
+/* Bytes per entry of the vector table. */
+#define cycleVECTOR_SIZE		4U
+
+#define cycleIS_RETI( usOp )	( ( usOp ) == 0x9518U )
+
+/* Paths of the display interrupt. */
+#define cyclePATH_SLOT			0
+#define cyclePATH_FRAME			1
+#define cyclePATH_OFF			2
+#define cycleNUM_PATHS			3
+
+/* Opcodes that end a counted call or leave the function for another one. */
+#define cycleIS_CALL( usOp )	( ( ( ( usOp ) & 0xFE0EU ) == 0x940EU ) || ( ( ( usOp ) & 0xF000U ) == 0xD000U ) )
+#define cycleIS_RET( usOp )		( ( usOp ) == 0x9508U )
+
+typedef struct xCYCLE_FUNCTION
+{
+	const char *pcName;
+	unsigned long ulStart;
+	unsigned long ulEnd;
+	unsigned long ulExpected[ cycleMAX_EXPECTED ];
+	int iNumExpected;
+
+	int xInCall;							/*< A call is being counted. */
+	int xInterrupted;						/*< ... and an interrupt was taken within it. */
+	unsigned long ulCycles;
+
+	unsigned long ulCalls;
+	unsigned long ulInterrupted;
+	unsigned long ulWrong;
+	unsigned long ulHistogram[ cycleMAX_HISTOGRAM ][ 2 ];	/*< Cycle count, calls. */
+	int iHistogramSize;
+} xCycleFunction;
+
+typedef struct xCYCLE_DISPLAY
+{
+	unsigned long ulVector;					/*< Byte address of the vector. */
+	unsigned long ulPtr;					/*< RAM addresses of ptr and off_phase. */
+	unsigned long ulOffPhase;
+	unsigned long ulDigits;
+	unsigned long ulMax;
+
+	int xInIsr;
+	int xInterrupted;
+	int iPath;
+	unsigned long ulCycles;
+
+	unsigned long ulCalls;
+	unsigned long ulInterrupted;
+	unsigned long ulOver;
+	unsigned long ulPathCalls[ cycleNUM_PATHS ];
+	unsigned long ulPathMin[ cycleNUM_PATHS ];
+	unsigned long ulPathMax[ cycleNUM_PATHS ];
+} xCycleDisplay;
+
+static const char * const pcPathNames[ cycleNUM_PATHS ] = { "slot", "frame", "off" };
+
+static xCycleFunction xFunctions[ cycleMAX_FUNCTIONS ];
+static int iNumFunctions;
+static xCycleDisplay xDisplay;
+static int xDisplayChecked;
+/*-----------------------------------------------------------*/
+
+/*
+ * <function>=<address>:<size>:<cycles>[,<cycles>...], numbers as strtoul()
+ * takes them (0x for hex).
+ */
+static int prvParseFunction( char *pcArg, xCycleFunction *pxFunction )
+{
+char *pcNext;
+unsigned long ulSize;
+
+	pcNext = strchr( pcArg, '=' );
+	if( pcNext == NULL )
+	{
+		return 0;
+	}
+	*pcNext++ = '\0';
+	pxFunction->pcName = pcArg;
+
+	pxFunction->ulStart = strtoul( pcNext, &pcNext, 0 );
+	if( *pcNext++ != ':' )
+	{
+		return 0;
+	}
+	ulSize = strtoul( pcNext, &pcNext, 0 );
+	if( ( *pcNext++ != ':' ) || ( ulSize == 0UL ) )
+	{
+		return 0;
+	}
+	pxFunction->ulEnd = pxFunction->ulStart + ulSize;
+
+	do
+	{
+		if( pxFunction->iNumExpected == cycleMAX_EXPECTED )
+		{
+			return 0;
+		}
+		pxFunction->ulExpected[ pxFunction->iNumExpected++ ] = strtoul( pcNext, &pcNext, 0 );
+	} while( *pcNext++ == ',' );
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * display=<vector>:<ptr>:<off_phase>:<digits>:<max>, the vector by number,
+ * the addresses as avr-nm prints them (data at 0x800000).
+ */
+static int prvParseDisplay( const char *pcArg, xCycleDisplay *pxDisplay )
+{
+char *pcNext;
+
+	pxDisplay->ulVector = strtoul( pcArg, &pcNext, 0 ) * cycleVECTOR_SIZE;
+	if( *pcNext++ != ':' )
+	{
+		return 0;
+	}
+	pxDisplay->ulPtr = strtoul( pcNext, &pcNext, 0 ) & 0xFFFFUL;
+	if( *pcNext++ != ':' )
+	{
+		return 0;
+	}
+	pxDisplay->ulOffPhase = strtoul( pcNext, &pcNext, 0 ) & 0xFFFFUL;
+	if( *pcNext++ != ':' )
+	{
+		return 0;
+	}
+	pxDisplay->ulDigits = strtoul( pcNext, &pcNext, 0 );
+	if( ( *pcNext++ != ':' ) || ( pxDisplay->ulDigits == 0UL ) )
+	{
+		return 0;
+	}
+	pxDisplay->ulMax = strtoul( pcNext, &pcNext, 0 );
+
+	return ( *pcNext == '\0' ) && ( pxDisplay->ulVector != 0UL ) && ( pxDisplay->ulMax != 0UL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEndIsr( xCycleDisplay *pxDisplay )
+{
+int iPath = pxDisplay->iPath;
+
+	pxDisplay->xInIsr = 0;
+	pxDisplay->ulCalls++;
+
+	if( pxDisplay->xInterrupted )
+	{
+		pxDisplay->ulInterrupted++;
+		return;
+	}
+
+	if( ( pxDisplay->ulPathCalls[ iPath ] == 0UL ) || ( pxDisplay->ulCycles < pxDisplay->ulPathMin[ iPath ] ) )
+	{
+		pxDisplay->ulPathMin[ iPath ] = pxDisplay->ulCycles;
+	}
+	if( pxDisplay->ulCycles > pxDisplay->ulPathMax[ iPath ] )
+	{
+		pxDisplay->ulPathMax[ iPath ] = pxDisplay->ulCycles;
+	}
+	pxDisplay->ulPathCalls[ iPath ]++;
+
+	if( pxDisplay->ulCycles > pxDisplay->ulMax )
+	{
+		pxDisplay->ulOver++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Counts one instruction executed at xPc, taking ulCycles, for the display
+interrupt. */
+static void prvStepDisplay( avr_t *pxAvr, avr_flashaddr_t xPc, unsigned short usOp, unsigned long ulCycles )
+{
+xCycleDisplay *pxDisplay = &xDisplay;
+
+	if( !pxDisplay->xInIsr )
+	{
+		if( xPc != pxDisplay->ulVector )
+		{
+			return;
+		}
+
+		/* The jmp of the vector: nothing of the interrupt has run yet. */
+		pxDisplay->xInIsr = 1;
+		pxDisplay->xInterrupted = 0;
+		pxDisplay->ulCycles = 0UL;
+		if( pxAvr->data[ pxDisplay->ulOffPhase ] != 0U )
+		{
+			pxDisplay->iPath = cyclePATH_OFF;
+		}
+		else if( ( unsigned long ) pxAvr->data[ pxDisplay->ulPtr ] + 1UL >= pxDisplay->ulDigits )
+		{
+			pxDisplay->iPath = cyclePATH_FRAME;
+		}
+		else
+		{
+			pxDisplay->iPath = cyclePATH_SLOT;
+		}
+	}
+
+	pxDisplay->ulCycles += ulCycles;
+
+	if( pxAvr->pc < cycleVECTORS_END )
+	{
+		pxDisplay->xInterrupted = 1;
+	}
+
+	if( cycleIS_RETI( usOp ) )
+	{
+		prvEndIsr( pxDisplay );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEndCall( xCycleFunction *pxFunction )
+{
+int i;
+
+	pxFunction->xInCall = 0;
+	pxFunction->ulCalls++;
+
+	if( pxFunction->xInterrupted )
+	{
+		pxFunction->ulInterrupted++;
+		return;
+	}
+
+	for( i = 0; i < pxFunction->iHistogramSize; i++ )
+	{
+		if( pxFunction->ulHistogram[ i ][ 0 ] == pxFunction->ulCycles )
+		{
+			break;
+		}
+	}
+	if( i < pxFunction->iHistogramSize )
+	{
+		pxFunction->ulHistogram[ i ][ 1 ]++;
+	}
+	else if( i < cycleMAX_HISTOGRAM )
+	{
+		pxFunction->ulHistogram[ i ][ 0 ] = pxFunction->ulCycles;
+		pxFunction->ulHistogram[ i ][ 1 ] = 1UL;
+		pxFunction->iHistogramSize++;
+	}
+
+	for( i = 0; i < pxFunction->iNumExpected; i++ )
+	{
+		if( pxFunction->ulExpected[ i ] == pxFunction->ulCycles )
+		{
+			return;
+		}
+	}
+	pxFunction->ulWrong++;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+elf_firmware_t xFirmware;
+avr_t *pxAvr;
+avr_flashaddr_t xPc;
+avr_cycle_count_t xCycle, xEndCycle;
+unsigned short usOp;
+xCycleFunction *pxFunction;
+int i, j, iState, xRunning, xFailed = 0;
+
+	if( argc < 4 )
+	{
+		fprintf( stderr, "usage: %s <elf> <ms> [display=<vector>:<ptr>:<off_phase>:<digits>:<max>] <function>=<address>:<size>:<cycles>[,<cycles>...] ...\n", argv[ 0 ] );
+		return EXIT_FAILURE;
+	}
+
+	for( i = 3; i < argc; i++ )
+	{
+		if( strncmp( argv[ i ], "display=", 8 ) == 0 )
+		{
+			if( xDisplayChecked || !prvParseDisplay( argv[ i ] + 8, &xDisplay ) )
+			{
+				fprintf( stderr, "cyclecheck: bad display argument %s\n", argv[ i ] );
+				return EXIT_FAILURE;
+			}
+			xDisplayChecked = 1;
+		}
+		else if( ( iNumFunctions == cycleMAX_FUNCTIONS ) || !prvParseFunction( argv[ i ], &xFunctions[ iNumFunctions++ ] ) )
+		{
+			fprintf( stderr, "cyclecheck: bad function argument %s\n", argv[ i ] );
+			return EXIT_FAILURE;
+		}
+	}
+
+	memset( &xFirmware, 0, sizeof( xFirmware ) );
+	if( elf_read_firmware( argv[ 1 ], &xFirmware ) != 0 )
+	{
+		fprintf( stderr, "cyclecheck: cannot read %s\n", argv[ 1 ] );
+		return EXIT_FAILURE;
+	}
+
+	pxAvr = avr_make_mcu_by_name( cycleMCU );
+	if( pxAvr == NULL )
+	{
+		fprintf( stderr, "cyclecheck: simavr has no %s\n", cycleMCU );
+		return EXIT_FAILURE;
+	}
+	avr_init( pxAvr );
+	avr_load_firmware( pxAvr, &xFirmware );
+	pxAvr->frequency = cycleF_CPU;
+
+	xEndCycle = ( avr_cycle_count_t ) strtoul( argv[ 2 ], NULL, 0 ) * ( cycleF_CPU / 1000UL );
+
+	while( pxAvr->cycle < xEndCycle )
+	{
+		xPc = pxAvr->pc;
+		xCycle = pxAvr->cycle;
+		usOp = ( unsigned short ) ( pxAvr->flash[ xPc ] | ( pxAvr->flash[ xPc + 1 ] << 8 ) );
+		xRunning = ( pxAvr->state == cpu_Running );
+
+		iState = avr_run( pxAvr );
+		if( ( iState == cpu_Done ) || ( iState == cpu_Crashed ) )
+		{
+			fprintf( stderr, "cyclecheck: the firmware stopped at 0x%04lx\n", ( unsigned long ) pxAvr->pc );
+			return EXIT_FAILURE;
+		}
+
+		/* Only an instruction executed counts, not a step of sleep. */
+		if( !xRunning )
+		{
+			continue;
+		}
+
+		if( xDisplayChecked )
+		{
+			prvStepDisplay( pxAvr, xPc, usOp, ( unsigned long ) ( pxAvr->cycle - xCycle ) );
+		}
+
+		for( i = 0; i < iNumFunctions; i++ )
+		{
+			pxFunction = &xFunctions[ i ];
+			if( ( xPc < pxFunction->ulStart ) || ( xPc >= pxFunction->ulEnd ) )
+			{
+				continue;
+			}
+
+			if( xPc == pxFunction->ulStart )
+			{
+				pxFunction->xInCall = 1;
+				pxFunction->xInterrupted = 0;
+				pxFunction->ulCycles = 0UL;
+			}
+			if( !pxFunction->xInCall )
+			{
+				continue;
+			}
+
+			if( pxAvr->pc < cycleVECTORS_END )
+			{
+				pxFunction->xInterrupted = 1;
+			}
+
+			if( cycleIS_RET( usOp ) )
+			{
+				prvEndCall( pxFunction );
+			}
+			else if( !cycleIS_CALL( usOp ) )
+			{
+				pxFunction->ulCycles += ( unsigned long ) ( pxAvr->cycle - xCycle );
+			}
+		}
+	}
+
+	for( i = 0; i < iNumFunctions; i++ )
+	{
+		pxFunction = &xFunctions[ i ];
+		printf( "%s: %lu calls (%lu interrupted, not checked), cycles", pxFunction->pcName, pxFunction->ulCalls, pxFunction->ulInterrupted );
+		for( j = 0; j < pxFunction->iHistogramSize; j++ )
+		{
+			printf( " %lu x%lu", pxFunction->ulHistogram[ j ][ 0 ], pxFunction->ulHistogram[ j ][ 1 ] );
+		}
+		printf( "\n" );
+
+		if( ( pxFunction->ulCalls == 0UL ) || ( pxFunction->ulWrong != 0UL ) )
+		{
+			fprintf( stderr, "cyclecheck: %s: %lu calls, %lu with other than the expected cycles\n", pxFunction->pcName, pxFunction->ulCalls, pxFunction->ulWrong );
+			xFailed = 1;
+		}
+	}
+
+	if( xDisplayChecked )
+	{
+		printf( "display interrupt: %lu calls (%lu interrupted, not checked)", xDisplay.ulCalls, xDisplay.ulInterrupted );
+		for( i = 0; i < cycleNUM_PATHS; i++ )
+		{
+			if( xDisplay.ulPathCalls[ i ] != 0UL )
+			{
+				printf( ", %s %lu x %lu...%lu cycles", pcPathNames[ i ], xDisplay.ulPathCalls[ i ], xDisplay.ulPathMin[ i ], xDisplay.ulPathMax[ i ] );
+			}
+		}
+		printf( "\n" );
+
+		if( ( xDisplay.ulPathCalls[ cyclePATH_SLOT ] == 0UL ) || ( xDisplay.ulPathCalls[ cyclePATH_FRAME ] == 0UL ) || ( xDisplay.ulOver != 0UL ) )
+		{
+			fprintf( stderr, "cyclecheck: display interrupt: %lu slot and %lu frame paths, %lu over %lu cycles\n",
+					 xDisplay.ulPathCalls[ cyclePATH_SLOT ], xDisplay.ulPathCalls[ cyclePATH_FRAME ], xDisplay.ulOver, xDisplay.ulMax );
+			xFailed = 1;
+		}
+	}
+
+	return xFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
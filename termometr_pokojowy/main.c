@@ -1,324 +1,643 @@
-/** \mainpage Autorzy: Maciej Szewczyk, Krzysztof Tomaski
-	 Zaoenia:
-	- termometr wyposaony jest w wywietlacz siedmiosegmentowy LED, diody LED, przyciski oraz czujnik
-	temperatury typu DS1820,
-	- termometr realizuje pomiar biecej temperatury z rozdzielczoci 0.1?C, rejestracj, w zadanym okresie
-	czasu, temperatury maksymalnej i minimalnej oraz dodatkowo sygnalizacj przekroczenia ustawionych
-	progw temperatury (dolnego lub grnego),
-	- na wywietlaczu LED powinna by wywietlana temperatura bieca, a po naciniciu przycisku tempe-
-	ratura maksymalna, nastpnie minimalna (kada z wartoci dostpna jest przez czas ok. 3 sek., po czym
-	wywietlana jest znw temperatura bieca, rodzaj wywietlanej informacji sygnalizowany jest diodami
-	LED), jeden z przyciskw naley wykorzysta do zerowania zarejestrowanych do tej pory temperatur
-	maksymalnej i minimalnej, kolejny przycisk pozwala przej do trybu ustawiania temperatur progowych
-	(kolejno dolnego progu, nastpnie grnego), ktrych przekroczenie sygnalizowane jest diod LED (wyga-
-	szana podczas zerowania temperatur maksymalnej i minimalnej), zmiana ustawie wartoci temperatur
-	progowych moliwa jest przy uyciu dwch przyciskw (z funkcj autorepetycji) pozwalajcych na ich
-	zwikszanie lub zmniejszanie.
-	- projekt powinien zawiera m.in. zadania realizujce: obsug wywietlacza i diod LED (zadanie uaktywnia-
-	ne przerwaniem pochodzcym od jednego z licznikw/czasomierzy mikrokontrolera), obsug klawiatury,
-	pomiar temperatury biecej, maksymalnej i minimalnej, obsuga menu termometru; wymiana danych
-	pomidzy zadaniami powinna si odbywa z wykorzystaniem kolejek, semaforw
-*/
-/* Podczenie do procesora:
-	PORTC - segmenty wyswietlacza LED
-	PB0 ... PB3 - cyfry wywietlacza LED
-	PA0 - dioda LED1 sygnalizujca wywietlanie temperatury biecej
-	PA1 - dioda LED2 sygnalizujca wywietlanie zarejestrowanej temperatury minimalnej
-	PA2 - dioda LED3 sygnalizujca wywietlanie zarejestrowanej temperatury maksymalnej
-	PA3 - dioda LED4 sygnalizujca ustawianie dolnego progu
-	PA4 - dioda LED5 sygnalizujca ustawianie grnego progu
-	PA5 - dioda LED6 sygnalizujca przekroczenie jednego z ustawionych progw
-	PD0 - przycisk do zmiany, ktra temperatura ma by wywietlana
-	PD1 - przycisk zerowania zarejestrowanych temperatur
-	PD2 - przycisk do wejcia do trybu ustawiania temperatur progowych
-	PD3 - przycisk do zwikszania temperatury progowej
-	PD4 - przycisk do zmniejszania temperatury progowej
-	PD5 - magistrala 1-wire, czujnik temperatury DS18B20
-*/
-
-
-#include <avr/interrupt.h>
-#include <avr/io.h>
-#include <avr/pgmspace.h>
-
-
-/* Scheduler include files. */
-#include "FreeRTOS.h"
-#include "task.h"
-#include "semphr.h"
-#include "ds18x20.h"
-
-
-///priorytet zadania do obsugi czujnika temperatury
-#define DS18B20_TASK_PRIORITY			( tskIDLE_PRIORITY + 2 )
-///priorytet zadania obsugujcego diody led i przyciski
-#define KEYS__LEDS_TASK_PRIORITY			( tskIDLE_PRIORITY + 1 )
-
-#define NUMBER_OF_DIGITS 4
-#define LED_digits		PORTB	
-#define LED_D0			PB0	
-#define LED_D1			PB1
-#define LED_D2			PB2
-#define LED_D3			PB3
-#define LED_segments	PORTC
-
-///przycisk do zmiany, ktra temperatura ma by wywietlana
-#define KEY1	(1<<PD0)
-///przycisk zerowania zarejestrowanych temperatur
-#define KEY2	(1<<PD1)
-///przycisk do wejcia do trybu ustawiania temperatur progowych
-#define KEY3	(1<<PD2)
-///przycisk do zwikszania temperatury progowej
-#define KEY4	(1<<PD3)
-///przycisk do zmniejszania temperatury progowej
-#define KEY5	(1<<PD4)
-
-#define MODE_TEMP_ACT 0
-#define MODE_TEMP_MIN 1
-#define MODE_TEMP_MAX 2
-#define MODE_TEMP_ALARM_MIN 3
-#define MODE_TEMP_ALARM_MAX 4
-
-#define LED_PORT PORTA
-///dioda LED1 sygnalizujca wywietlanie temperatury biecej
-#define LED1 (1<<PA0)
-///dioda LED2 sygnalizujca wywietlanie zarejestrowanej temperatury minimalnej
-#define LED2 (1<<PA1)
-///dioda LED3 sygnalizujca wywietlanie zarejestrowanej temperatury maksymalnej
-#define LED3 (1<<PA2)
-///dioda LED4 sygnalizujca ustawianie dolnego progu
-#define LED4 (1<<PA3)
-///dioda LED5 sygnalizujca ustawianie grnego progu
-#define LED5 (1<<PA4)
-///dioda LED6 sygnalizujca przekroczenie jednego z ustawionych progw
-#define LED6 (1<<PA5)
-
-/**
-    Tablica konwersji wartosci BIN na kod wskaznika siedmiosegmentowego
- */
-const uint8_t seg7[] PROGMEM = { 0b00111111, 0b00000110, 0b01011011, 0b01001111, 0b01100110,
-	                             0b01101101, 0b01111101, 0b00000111, 0b01111111, 0b01101111};
-
-
-/**
-    Zmienne wykorzystywane do obslugi wyswietlacza LED
- */
-volatile uint8_t LED_buf[NUMBER_OF_DIGITS];
-volatile uint8_t LED_ptr;
-
-uint8_t mode=MODE_TEMP_ACT,first_temp;	
-int16_t temp_act, temp_min, temp_max, temp_alarm_min=500, temp_alarm_max=800;
-
-///semafor ustawiany w przerwaniu co 2s, co powoduje rozpoczcie pomiaru temperatury
-static xSemaphoreHandle Tim2s;
-
-///wywietlanie temperatury
-static void prvDisplayTemp(int16_t val);
-static void prvDisplayTemp(int16_t val)
-{
-	int16_t val_temp;
-	if( val<0 ){
-		LED_buf[3] = 0x80;
-		val_temp = val * (-1);
-	}
-	else { 
-		LED_buf[3] = 0; 
-		val_temp = val;
-		}
-	if( val_temp<100 ){ LED_buf[2] = 0; }
-		else{ LED_buf[2] = pgm_read_byte(&seg7[val_temp/100]); }
-	LED_buf[1] = 0x80 | pgm_read_byte(&seg7[(val_temp/10)%10]);
-	LED_buf[0] = pgm_read_byte(&seg7[val_temp%10]);
-}
-
-
-///inicjalizacja portw
-static void prvInitHardware(void);
-static void prvInitHardware(void)
-{
-	// porty wyswietlacza LED
-	DDRB |= 0x0F;
-	PORTB &= ~0x0F;
-	DDRC = 0xFF;
-	PORTC = 0x00;
-
-	//pull up pinw podczonych do przyciskw
-	PORTD|=KEY1|KEY2|KEY3|KEY4|KEY5;
-
-	//diody led
-	DDRA|=LED1|LED2|LED3|LED4|LED5|LED6;
-	LED_PORT |=(LED1|LED2|LED3|LED4|LED5|LED6);
-
-	// inicjalizacja licznika Timer0 i przerwania F_CPU=16MHz
-    TIMSK |= (1<<OCIE0);
-    OCR0 = 30; //2ms
-	// Prescaler = 1024 
-    TCCR0 |= (1<<WGM01) | (1<<CS02) | (0<<CS01) | (1<<CS00);
-	
-	//wykrycie czujnika na magistrali
-	search_sensors(); 
-}
-
-///przerwanie do obsugi wywietlacza siedmiosegmentowego oraz odmierzania czasu
-ISR(TIMER0_COMP_vect) 
-{
-	static uint16_t t = 0;
-	
-	signed portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
-
-	// obsluga odmierzania czasu 1s
-	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-	if (t++ > 500)
-	{
-		t = 0;
-		xSemaphoreGiveFromISR(Tim2s, &xHigherPriorityTaskWoken);
-	}
-	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-	// obsluga wyswietlacza siedmiosegmentowego LED
-	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-    if ((++LED_ptr) > NUMBER_OF_DIGITS-1) LED_ptr = 0;
-	LED_digits |= 0x0F;
-	LED_segments = ~LED_buf[LED_ptr]; 
-	LED_digits &=~(1<<LED_ptr);
-	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-
-	if (xHigherPriorityTaskWoken == pdTRUE) taskYIELD();
-}
-
-///obsuga przyciskw i diod LED
-static void vTaskKeysLed(void *pvParameters);
-static void vTaskKeysLed(void *pvParameters)
-{
-	static uint8_t KBD1,KBD2,press,time_switch_mode,step;
-	for( ;; )
-	{
-			KBD1=PIND & 0x1F;
-		if( (KBD1 !=0x1F) && (KBD1 == KBD2) ){
-				if (press==0)
-				{
-					switch ((~KBD1)&0x1F)
-					{
-						case KEY1:	//zmiana wywietlanej temperatury
-							if( mode==MODE_TEMP_ACT ){ mode = MODE_TEMP_MIN; time_switch_mode=60; }
-							else{ mode=MODE_TEMP_ACT; time_switch_mode=0; }
-						break;
-						case KEY2:	//zerowanie zarejestrowanych temperatur
-							temp_min=temp_act; temp_max=temp_act;
-						break;
-						case KEY3:	//wejcie do trybu ustawiania progu dolnego, kolejne wcinicie - ustawianie progu grnego
-							if( mode == MODE_TEMP_ALARM_MIN ){ mode = MODE_TEMP_ALARM_MAX; }
-							else{ mode = MODE_TEMP_ALARM_MIN; }
-						break;
-					
-								
-					}
-					press=1;
-				}	
-					if( (step==0) || (step>20) ){
-						switch ((~KBD1)&0x1F)
-						{			
-							case KEY4:	//zmniejszenie wartoci progowej
-								if( mode == MODE_TEMP_ALARM_MIN ){ temp_alarm_min--; }
-								if( mode == MODE_TEMP_ALARM_MAX ){ temp_alarm_max--; }
-							break;
-							case KEY5:	//zwikszenie wartoci progowej
-								if( mode == MODE_TEMP_ALARM_MIN ){ temp_alarm_min++; }
-								if( mode == MODE_TEMP_ALARM_MAX ){ temp_alarm_max++; }
-							break;						
-						}						
-					}
-					if(step<21){ step++; }
-				}
-			
-		if(KBD1==0x1F){ press=0; step=0; }
-		KBD2=KBD1;
-		
-		if( time_switch_mode ){ time_switch_mode--; }
-		else{
-			if( mode == MODE_TEMP_MIN ){ mode=MODE_TEMP_MAX; time_switch_mode = 60; }
-			else if( mode == MODE_TEMP_MAX ){ mode=MODE_TEMP_ACT; }
-		}
-
-		switch( mode ){
-			case MODE_TEMP_ACT:
-				LED_PORT&=~LED1;	LED_PORT |=LED2|LED3|LED4|LED5; prvDisplayTemp(temp_act);
-			break;
-			case MODE_TEMP_MIN:
-				LED_PORT&=~LED2;	LED_PORT |=LED1|LED3|LED4|LED5; prvDisplayTemp(temp_min);
-			break;
-			case MODE_TEMP_MAX:
-				LED_PORT&=~LED3;	LED_PORT |=LED1|LED2|LED4|LED5; prvDisplayTemp(temp_max);
-			break;
-			case MODE_TEMP_ALARM_MIN:
-				LED_PORT&=~LED4;	LED_PORT |=LED1|LED2|LED3|LED5; prvDisplayTemp(temp_alarm_min);
-			break;
-			case MODE_TEMP_ALARM_MAX:
-				LED_PORT&=~LED5;	LED_PORT |=LED1|LED2|LED3|LED4; prvDisplayTemp(temp_alarm_max);
-			break;
-		}
-		if( (temp_act<temp_alarm_min) || (temp_act>temp_alarm_max) ){ LED_PORT&=~LED6; }
-		else{ LED_PORT |=LED6; }
-
-		vTaskDelay( 50 / portTICK_RATE_MS );
-	}
-}
-///pomiar temperatury
-static void vTaskMeasTemp(void *pvParameters);
-static void vTaskMeasTemp(void *pvParameters)
-{
-	uint8_t sign, integer, fraction;
-	for( ;; )
-	{
-		if (xSemaphoreTake(Tim2s, portMAX_DELAY)){
-			DS18X20_start_meas( DS18X20_POWER_EXTERN, NULL );
-			vTaskDelay( 1000/portTICK_RATE_MS );
-			if( DS18X20_OK == DS18X20_read_meas(gSensorIDs[0], &sign, &integer, &fraction) ) {
-				temp_act = ((uint16_t)integer*10) + fraction;
-				if(sign==1){ temp_act*=-1; }
-				if ( first_temp==0 )
-				{
-					temp_min=temp_act;
-					temp_max=temp_act;
-					first_temp=1;
-				}
-				else{
-				if( temp_act < temp_min ){ temp_min = temp_act; }
-				if( temp_act > temp_max ){ temp_max = temp_act; }					
-				}
-
-			}
-			else {
-			}	
-		}
-		
-	}
-}
-
-/*-----------------------------------------------------------*/
-
-void main(void)
-{
-	prvInitHardware();
-
-	vSemaphoreCreateBinary(Tim2s);
-
-	xTaskCreate( vTaskMeasTemp, 
-	             (const int8_t*) "vTaskMeasTemp",
-				 configMINIMAL_STACK_SIZE,
-				 NULL,
-				 DS18B20_TASK_PRIORITY,
-				 NULL);
-				 
-	xTaskCreate( vTaskKeysLed,
-				(const int8_t*) "vTaskKeysLed",
-				configMINIMAL_STACK_SIZE,
-				NULL,
-				KEYS__LEDS_TASK_PRIORITY,
-				NULL);
-
-	vTaskStartScheduler();
-
-	for(;;);
-}
-/*-----------------------------------------------------------*/
+/** \mainpage Autorzy: Maciej Szewczyk, Krzysztof Tomański
+	 Założenia:
+	- termometr wyposażony jest w wyświetlacz siedmiosegmentowy LED, diody LED, przyciski oraz czujnik
+	temperatury typu DS1820,
+	- termometr realizuje pomiar bieżącej temperatury z rozdzielczością 0.1?C, rejestrację, w zadanym okresie
+	czasu, temperatury maksymalnej i minimalnej oraz dodatkowo sygnalizację przekroczenia ustawionych
+	progów temperatury (dolnego lub górnego),
+	- na wyświetlaczu LED powinna być wyświetlana temperatura bieżąca, a po naciśnięciu przycisku tempe-
+	ratura maksymalna, następnie minimalna (każda z wartości dostępna jest przez czas ok. 3 sek., po czym
+	wyświetlana jest znów temperatura bieżąca, rodzaj wyświetlanej informacji sygnalizowany jest diodami
+	LED), jeden z przycisków należy wykorzystać do zerowania zarejestrowanych do tej pory temperatur
+	maksymalnej i minimalnej, kolejny przycisk pozwala przejść do trybu ustawiania temperatur progowych
+	(kolejno dolnego progu, następnie górnego), których przekroczenie sygnalizowane jest diodą LED (wyga-
+	szana podczas zerowania temperatur maksymalnej i minimalnej), zmiana ustawień wartości temperatur
+	progowych możliwa jest przy użyciu dwóch przycisków (z funkcją autorepetycji) pozwalających na ich
+	zwiększanie lub zmniejszanie.
+	- projekt powinien zawierać m.in. zadania realizujące: obsługę wyświetlacza i diod LED (zadanie uaktywnia-
+	ne przerwaniem pochodzącym od jednego z liczników/czasomierzy mikrokontrolera), obsługę klawiatury,
+	pomiar temperatury bieżącej, maksymalnej i minimalnej, obsługa menu termometru; wymiana danych
+	pomiędzy zadaniami powinna się odbywać z wykorzystaniem kolejek, semaforów
+*/
+/* Podłączenie do procesora:
+	PORTC - segmenty wyswietlacza LED
+	PB0 ... PB3 - cyfry wyświetlacza LED
+	PA0 - dioda LED1 sygnalizująca wyświetlanie temperatury bieżącej
+	PA1 - dioda LED2 sygnalizująca wyświetlanie zarejestrowanej temperatury minimalnej
+	PA2 - dioda LED3 sygnalizująca wyświetlanie zarejestrowanej temperatury maksymalnej
+	PA3 - dioda LED4 sygnalizująca ustawianie dolnego progu
+	PA4 - dioda LED5 sygnalizująca ustawianie górnego progu
+	PA5 - dioda LED6 sygnalizująca przekroczenie jednego z ustawionych progów
+	PD0 - przycisk do zmiany, która temperatura ma być wyświetlana
+	PD1 - przycisk zerowania zarejestrowanych temperatur
+	PD2 - przycisk do wejścia do trybu ustawiania temperatur progowych
+	PD3 - przycisk do zwiększania temperatury progowej
+	PD4 - przycisk do zmniejszania temperatury progowej
+	PD5 - magistrala 1-wire, czujnik temperatury DS18B20
+*/
+
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "ds18x20.h"
+#include "ow_engine.h"
+#include "keypad.h"
+#include "display.h"
+#include "hal.h"
+
+
+///priorytety etapów potoku pomiar -> statystyki -> wyświetlanie: każdy etap ma wyższy priorytet
+///niż jego odbiorca, więc wolniejszy odbiorca nigdy nie wstrzymuje nadawcy
+///pomiar i statystyki liczone od najwyższego priorytetu - przy większym configMAX_PRIORITIES
+///między nimi a zadaniem wyświetlania zostają wolne priorytety dla kolejnych zadań
+///priorytet zadania do obsługi czujnika temperatury
+#define DS18B20_TASK_PRIORITY			( configMAX_PRIORITIES - 1 )
+///priorytet zadania liczącego statystyki
+#define STATS_TASK_PRIORITY				( configMAX_PRIORITIES - 2 )
+///priorytet zadania obsługującego diody led i przyciski
+#define KEYS__LEDS_TASK_PRIORITY			( tskIDLE_PRIORITY + 1 )
+//trzy etapy potoku nad zadaniem bezczynności: przy configMAX_PRIORITIES < 4 statystyki miałyby
+//priorytet wyświetlania (albo bezczynności) i kolejność etapów nie byłaby zachowana; configMAX_PRIORITIES
+//ma rzutowanie, więc zamiast #if błąd kompilacji z ujemnego rozmiaru tablicy (jak w tasks.c)
+typedef char pipeline_priorities_check_t[ ( configMAX_PRIORITIES >= 4 ) ? 1 : -1 ];
+///stos zadania pomiaru - bufor scratchpadu i transakcje 1-Wire na stosie
+#define DS18B20_TASK_STACK_SIZE			( configMINIMAL_STACK_SIZE + 32 )
+
+///przycisk do zmiany, która temperatura ma być wyświetlana
+#define KEY1	(1<<PD0)
+///przycisk zerowania zarejestrowanych temperatur
+#define KEY2	(1<<PD1)
+///przycisk do wejścia do trybu ustawiania temperatur progowych
+#define KEY3	(1<<PD2)
+///przycisk do zwiększania temperatury progowej
+#define KEY4	(1<<PD3)
+///przycisk do zmniejszania temperatury progowej
+#define KEY5	(1<<PD4)
+
+///zdarzenie nowych odczytów temperatury w kolejce ui_queue, obok zdarzeń przycisków (typ wolny w keypad_event_t)
+#define EVENT_MEAS	0xE0
+#define UI_QUEUE_LEN	6
+///próbki vTaskMeasTemp -> vTaskStats: zapas na kilka pomiarów w trybie szybkim
+#define SAMPLE_QUEUE_LEN	4
+///tyle kolejnych nieudanych odczytów czujnika, zanim zamiast jego ostatniej dobrej temperatury
+///pojawią się kreski - pojedynczy błąd (zakłócenie na magistrali) nie gasi wyniku
+#define STATS_FAIL_SAMPLES	3
+
+///powtórzenia KEY4/KEY5, po których próg zmienia się o 1°C zamiast o 0.1°C
+#define UI_REPEAT_FAST	20
+
+///granice ustawiania progów (1/16°C)
+#define ALARM_LIMIT_MIN		DS18X20_TEMP_CEL(-55)
+#define ALARM_LIMIT_MAX		DS18X20_TEMP_CEL(125)
+
+///czasy w ms: wyświetlanie temperatury min., maks. i średniej, numeru czujnika/rozdzielczości
+#define UI_MODE_TIME		3000
+#define UI_INFO_TIME		1000
+
+///okres pomiaru w ms (vTaskDelayUntil, stałe odstępy próbek); nie krótszy niż pomiar 12-bitowy z odczytem;
+///można podać przy kompilacji (Host/Makefile: make MEAS_PERIOD=n)
+#ifndef MEAS_PERIOD_MS
+#define MEAS_PERIOD_MS		1000
+#endif
+#if MEAS_PERIOD_MS < DS18B20_TCONV_12BIT + 50
+	#error "MEAS_PERIOD_MS krótszy niż czas pomiaru"
+#endif
+
+#define MODE_TEMP_ACT 0
+#define MODE_TEMP_MIN 1
+#define MODE_TEMP_MAX 2
+#define MODE_TEMP_ALARM_MIN 3
+#define MODE_TEMP_ALARM_MAX 4
+#define MODE_SENSOR 5
+#define MODE_RESOLUTION 6
+#define MODE_TEMP_AVG 7
+
+///rozdzielczość czujników DS18B20: zwykła (750ms na pomiar) i w trybie szybkim (94ms)
+#define MEAS_RES_NORMAL	DS18B20_12_BIT
+#define MEAS_RES_FAST	DS18B20_9_BIT
+
+///dioda LED1 sygnalizująca wyświetlanie temperatury bieżącej
+#define LED1 (1<<PA0)
+///dioda LED2 sygnalizująca wyświetlanie zarejestrowanej temperatury minimalnej
+#define LED2 (1<<PA1)
+///dioda LED3 sygnalizująca wyświetlanie zarejestrowanej temperatury maksymalnej
+#define LED3 (1<<PA2)
+///(LED2 i LED3 razem - temperatura średnia)
+///dioda LED4 sygnalizująca ustawianie dolnego progu
+#define LED4 (1<<PA3)
+///dioda LED5 sygnalizująca ustawianie górnego progu
+#define LED5 (1<<PA4)
+///dioda LED6 sygnalizująca przekroczenie jednego z ustawionych progów
+#define LED6 (1<<PA5)
+
+///liczba czujników wykrytych na magistrali (stała po starcie) oraz czujnik wybrany do wyświetlania
+uint8_t sensors, sensor_sel;
+///tryb wyświetlania, czujnik i progi zmienia i czyta tylko vTaskKeysLed
+uint8_t mode=MODE_TEMP_ACT;
+///temperatury i progi w 1/16°C (DS18X20_TEMP_CEL), na 0.1°C zamieniane dopiero do wyświetlenia
+int16_t temp_alarm_min=DS18X20_TEMP_CEL(50), temp_alarm_max=DS18X20_TEMP_CEL(80);
+
+///próbka: jeden pomiar wszystkich czujników (sample_queue)
+typedef struct temp_sample {
+	unsigned long time;				//tick rozpoczęcia pomiaru (ulTaskGetTickCountExtended - bez przepełnienia)
+	uint8_t status[MAXSENSORS];		//DS18X20_OK lub błąd odczytu czujnika
+	int16_t temp[MAXSENSORS];
+} temp_sample_t;
+
+///wyniki vTaskStats gotowe do wyświetlenia (stats_queue, jeden element - zawsze najnowszy)
+typedef struct temp_stats {
+	unsigned long time;				//tick rozpoczęcia ostatniego pomiaru (jak temp_sample_t)
+	uint8_t reset;					//ostatnie wykonane zerowanie (reset_req)
+	uint8_t status[MAXSENSORS];		//DS18X20_OK lub błąd: jeszcze bez odczytu albo STATS_FAIL_SAMPLES nieudanych z rzędu
+	int16_t act[MAXSENSORS], min[MAXSENSORS], max[MAXSENSORS], avg[MAXSENSORS];
+} temp_stats_t;
+
+#if MAXSENSORS > 8
+	#error "maska czujników w vTaskStats ma 8 bitów"
+#endif
+
+///liczniki potoku - podgląd w debuggerze; każde pole ma jednego piszącego
+typedef struct pipe_counters {
+	uint16_t samples;				//próbki wysłane przez vTaskMeasTemp
+	uint16_t samples_dropped;		//pełna sample_queue - statystyki nie nadążają
+	uint8_t sample_depth_max;		//najwięcej próbek czekających w sample_queue
+	uint16_t batches;				//przebiegi vTaskStats, jedna publikacja na przebieg
+	uint8_t batch_max;				//najwięcej próbek obsłużonych w jednym przebiegu
+	uint16_t stats_replaced;		//wyniki zastąpione nowszymi przed odebraniem przez vTaskKeysLed
+} pipe_counters_t;
+volatile pipe_counters_t pipe;
+
+///zerowanie min./maks./średniej zamawiane przez vTaskKeysLed, wykonywane przez vTaskStats
+static volatile uint8_t reset_req;
+///tryb szybki: pomiary jeden za drugim, z rozdzielczością MEAS_RES_FAST
+volatile uint8_t fast_mode;
+
+///opóźnienie rozpoczęcia pomiaru względem planowanej chwili (ticki): ostatnie, największe
+///i liczba pominiętych okresów (pomiar dłuższy niż MEAS_PERIOD_MS) - podgląd w debuggerze
+volatile unsigned long meas_late, meas_late_max;
+volatile uint8_t meas_overruns;
+///zdarzenia keypad_event_t - przyciski z przerwania zegara systemowego, EVENT_MEAS z vTaskStats
+static xQueueHandle ui_queue;
+///potok: próbki z vTaskMeasTemp do vTaskStats, wyniki z vTaskStats do vTaskKeysLed
+static xQueueHandle sample_queue, stats_queue;
+
+///zawartość wyświetlacza - ramka budowana tylko po zmianie wyświetlanej wartości lub trybu
+#define DISP_NONE		0
+#define DISP_TEMP		1
+#define DISP_TEMP_EDIT	2	//ustawiany próg - cyfry migają
+#define DISP_SENSOR		3
+#define DISP_RESOLUTION	4
+#define DISP_NO_TEMP	5	//brak odczytu czujnika - kreski
+static uint8_t disp_what = DISP_NONE;
+static int16_t disp_val;
+
+///sprawdzenie, czy na wyświetlaczu jest już to samo (zwraca 0), jeśli nie - zapamiętanie nowej zawartości
+static uint8_t prvDisplayChanged(uint8_t what, int16_t val);
+static uint8_t prvDisplayChanged(uint8_t what, int16_t val)
+{
+	if( (what == disp_what) && (val == disp_val) ){ return 0; }
+	disp_what = what;
+	disp_val = val;
+	return 1;
+}
+
+
+///wyświetlanie temperatury podanej w 1/16°C, z dokładnością do 0.1°C; edit - migający próg
+static void prvDisplayTemp(int16_t val, uint8_t edit);
+static void prvDisplayTemp(int16_t val, uint8_t edit)
+{
+	display_frame_t *f;
+	uint8_t n, neg = 0;
+	if( !prvDisplayChanged(edit ? DISP_TEMP_EDIT : DISP_TEMP, val) ){ return; }
+	val = DS18X20_temp_to_decicel(val);
+	if( val<0 ){
+		neg = 1;
+		val = -val;
+	}
+	f = display_begin();
+	//zera wiodące wygaszone, minus tuż przed pierwszą cyfrą (od -55.0 do -0.1 są co najwyżej 3 cyfry)
+	n = display_number(f, val, 2);
+	f->seg[1] |= DISPLAY_DP;
+	if( neg && (n < DISPLAY_DIGITS) ){ f->seg[n] = DISPLAY_MINUS; }
+	if( edit ){ f->blink = (1<<DISPLAY_DIGITS) - 1; }
+	display_commit();
+}
+
+
+///kreski "----" zamiast temperatury czujnika, który przestał odpowiadać (albo jeszcze bez pomiaru)
+static void prvDisplayNoTemp(void);
+static void prvDisplayNoTemp(void)
+{
+	display_frame_t *f;
+	uint8_t i;
+	if( !prvDisplayChanged(DISP_NO_TEMP, 0) ){ return; }
+	f = display_begin();
+	for( i=0; i<DISPLAY_DIGITS; i++ ){ f->seg[i] = DISPLAY_MINUS; }
+	display_commit();
+}
+
+
+///temperatura z wyników vTaskStats, jeśli czujnik odpowiada (status w temp_stats_t); inaczej
+///ostatnia dobra wartość (albo 0.0 sprzed pierwszego pomiaru) wyglądałaby na bieżącą
+static void prvDisplayReading(uint8_t status, int16_t val);
+static void prvDisplayReading(uint8_t status, int16_t val)
+{
+	if( DS18X20_OK != status ){ prvDisplayNoTemp(); }
+	else{ prvDisplayTemp(val, 0); }
+}
+
+
+///zmiana progu (w 1/16°C) o step * 0.1°C - tyle, ile widać na wyświetlaczu
+static int16_t prvAlarmStep(int16_t temp, int8_t step);
+static int16_t prvAlarmStep(int16_t temp, int8_t step)
+{
+	temp = DS18X20_decicel_to_temp( DS18X20_temp_to_decicel(temp) + step );
+	//zakres pomiarowy czujników
+	if( temp < ALARM_LIMIT_MIN ){ temp = ALARM_LIMIT_MIN; }
+	if( temp > ALARM_LIMIT_MAX ){ temp = ALARM_LIMIT_MAX; }
+	return temp;
+}
+
+
+///wyświetlanie numeru czujnika (od 1) w postaci "-n-", kreski przyciemnione
+static void prvDisplaySensor(uint8_t n);
+static void prvDisplaySensor(uint8_t n)
+{
+	display_frame_t *f;
+	if( !prvDisplayChanged(DISP_SENSOR, n) ){ return; }
+	f = display_begin();
+	f->seg[2] = DISPLAY_MINUS;
+	f->seg[1] = display_seg7(n+1);	//n < MAXSENSORS <= 9
+	f->seg[0] = DISPLAY_MINUS;
+	display_set_level(f, (1<<2)|(1<<0), DISPLAY_LEVELS/4);
+	display_commit();
+}
+
+
+///wyświetlanie rozdzielczości pomiaru w bitach w postaci "r 12"
+static void prvDisplayResolution(uint8_t bits);
+static void prvDisplayResolution(uint8_t bits)
+{
+	display_frame_t *f;
+	if( !prvDisplayChanged(DISP_RESOLUTION, bits) ){ return; }
+	f = display_begin();
+	display_number(f, bits, 1);
+	f->seg[3] = 0x50;	//"r"
+	display_commit();
+}
+
+
+///inicjalizacja portów
+static void prvInitHardware(void);
+static void prvInitHardware(void)
+{
+	// wyswietlacz LED w przerwaniu Timer0 (co 2ms)
+	display_init();
+
+	//pull up pinów podłączonych do przycisków
+	HAL_OUT(KEYS_PORT, KEYS_PORT | KEY1|KEY2|KEY3|KEY4|KEY5);
+
+	//diody led
+	HAL_OUT(LED_DDR, LED_DDR | LED1|LED2|LED3|LED4|LED5|LED6);
+	HAL_LEDS_OFF(LED1|LED2|LED3|LED4|LED5|LED6);
+
+	//wykrycie czujników na magistrali
+	sensors = search_sensors(); 
+
+	//dalsza obsługa magistrali w przerwaniu Timer2
+	ow_engine_init();
+}
+
+///przerwanie zegara systemowego (1kHz, Timer1): przyciski;
+///wyświetlacz ma własne, krótkie przerwanie Timer0 (display.c)
+void vApplicationTickHook(void)
+{
+	static uint8_t k = 0;
+
+	//obudzone zadanie wybierze scheduler po powrocie z przerwania (bezczynne zadanie oddaje procesor)
+	signed portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+
+	// przyciski, zdarzenia do ui_queue
+	if( ++k >= KEYPAD_TICK_MS / portTICK_RATE_MS )
+	{
+		k = 0;
+		keypad_tick(&xHigherPriorityTaskWoken);
+	}
+}
+
+///ticki pozostałe do chwili end (0 - już minęła)
+static portTickType prvTicksLeft(portTickType now, portTickType end);
+static portTickType prvTicksLeft(portTickType now, portTickType end)
+{
+	portTickType left = end - now;
+	return ( left > UI_MODE_TIME / portTICK_RATE_MS ) ? 0 : left;
+}
+
+
+///KEY4/KEY5: zmiana progu o step * 0.1°C, poza ustawianiem progów - wybór czujnika (kierunek wg znaku step)
+static uint8_t prvKeyStep(int8_t step);
+static uint8_t prvKeyStep(int8_t step)
+{
+	if( mode == MODE_TEMP_ALARM_MIN ){ temp_alarm_min = prvAlarmStep(temp_alarm_min, step); }
+	else if( mode == MODE_TEMP_ALARM_MAX ){ temp_alarm_max = prvAlarmStep(temp_alarm_max, step); }
+	else if( sensors>1 ){
+		if( step<0 ){ sensor_sel = sensor_sel ? sensor_sel-1 : sensors-1; }
+		else{ sensor_sel = (sensor_sel+1 < sensors) ? sensor_sel+1 : 0; }
+		mode = MODE_SENSOR;
+		return 1;	//wyświetlanie numeru czujnika przez UI_INFO_TIME
+	}
+	return 0;
+}
+
+
+///obsługa przycisków i diod LED - zadanie budzone zdarzeniami z ui_queue oraz końcem odmierzanego czasu
+static void vTaskKeysLed(void *pvParameters);
+static void vTaskKeysLed(void *pvParameters)
+{
+	static uint8_t mode_timed, chord;
+	static portTickType mode_end;
+	static temp_stats_t snap;	//ostatnie wyniki z stats_queue
+	portTickType now, wait;
+	keypad_event_t ev;
+	uint8_t i, alarm, key, keys;
+	int8_t step;
+
+	for( i=0; i<MAXSENSORS; i++ ){ snap.status[i] = DS18X20_ERROR; }	//jeszcze bez wyników
+
+	for( ;; )
+	{
+		//bez zdarzeń zadanie śpi, dopóki nie trzeba zmienić trybu
+		now = xTaskGetTickCount();
+		wait = mode_timed ? prvTicksLeft(now, mode_end) : portMAX_DELAY;
+		if( xQueueReceive(ui_queue, &ev, wait) != pdTRUE ){ ev = 0; }
+		now = xTaskGetTickCount();
+
+		key = KEYPAD_EVENT_KEY(ev);
+		keys = KEYPAD_EVENT_KEYS(ev);
+		switch( KEYPAD_EVENT_TYPE(ev) )
+		{
+			case KEYPAD_PRESS:
+				if( keys & (keys-1) ){	//kilka przycisków naraz
+					//przełączenie trybu szybkiego, wyświetlana rozdzielczość; przyciski wciśnięte w tym samym
+					//odczycie dają dwa zdarzenia z tym samym stanem - przełącza tylko pierwsze
+					if( !chord && keys == (KEY1|KEY2) ){
+						fast_mode = !fast_mode;
+						mode = MODE_RESOLUTION; mode_timed = 1; mode_end = now + UI_INFO_TIME / portTICK_RATE_MS;
+					}
+					chord = 1;
+					break;
+				}
+				switch( key )
+				{
+					case KEY1:	//zmiana wyświetlanej temperatury
+						if( mode==MODE_TEMP_ACT ){ mode = MODE_TEMP_MIN; mode_timed = 1; mode_end = now + UI_MODE_TIME / portTICK_RATE_MS; }
+						else{ mode = MODE_TEMP_ACT; mode_timed = 0; }
+					break;
+					case KEY3:	//wejście do trybu ustawiania progu dolnego, kolejne wciśnięcie - ustawianie progu górnego
+						if( mode == MODE_TEMP_ALARM_MIN ){ mode = MODE_TEMP_ALARM_MAX; }
+						else{ mode = MODE_TEMP_ALARM_MIN; }
+						mode_timed = 0;
+					break;
+					case KEY4:	//zmniejszenie wartości progowej / poprzedni czujnik
+					case KEY5:	//zwiększenie wartości progowej / następny czujnik
+						if( prvKeyStep( (key==KEY4) ? -1 : 1 ) ){ mode_timed = 1; mode_end = now + UI_INFO_TIME / portTICK_RATE_MS; }
+					break;
+				}
+			break;
+			case KEYPAD_RELEASE:
+				//zerowanie zarejestrowanych temperatur po puszczeniu KEY2, o ile nie był częścią KEY1+KEY2
+				if( (key == KEY2) && !chord ){ reset_req++; }
+				if( keys == 0 ){ chord = 0; }
+			break;
+			case KEYPAD_REPEAT:	//autorepetycja KEY4/KEY5, po UI_REPEAT_FAST powtórzeniach krok 1°C
+				step = (KEYPAD_EVENT_COUNT(ev) > UI_REPEAT_FAST) ? 10 : 1;
+				if( prvKeyStep( (key==KEY4) ? -step : step ) ){ mode_timed = 1; mode_end = now + UI_INFO_TIME / portTICK_RATE_MS; }
+			break;
+		}
+
+		//koniec wyświetlania min./maks., numeru czujnika, rozdzielczości
+		if( mode_timed && !prvTicksLeft(now, mode_end) ){
+			mode_timed = 0;
+			if( mode == MODE_TEMP_MIN ){ mode=MODE_TEMP_MAX; mode_timed = 1; mode_end = now + UI_MODE_TIME / portTICK_RATE_MS; }
+			else if( mode == MODE_TEMP_MAX ){ mode=MODE_TEMP_AVG; mode_timed = 1; mode_end = now + UI_MODE_TIME / portTICK_RATE_MS; }
+			else{ mode=MODE_TEMP_ACT; }
+		}
+
+		//nowe wyniki statystyk (EVENT_MEAS); zerowanie jeszcze nie wykonane przez vTaskStats -
+		//min., maks. i średnia to bieżąca temperatura
+		if( ev == EVENT_MEAS ){ xQueueReceive(stats_queue, &snap, 0); }
+		if( snap.reset != reset_req ){
+			for( i=0; i<sensors; i++ ){ snap.min[i] = snap.act[i]; snap.max[i] = snap.act[i]; snap.avg[i] = snap.act[i]; }
+		}
+
+		switch( mode ){
+			case MODE_TEMP_ACT:
+				HAL_LEDS_ON(LED1);	HAL_LEDS_OFF(LED2|LED3|LED4|LED5); prvDisplayReading(snap.status[sensor_sel], snap.act[sensor_sel]);
+			break;
+			case MODE_TEMP_MIN:
+				HAL_LEDS_ON(LED2);	HAL_LEDS_OFF(LED1|LED3|LED4|LED5); prvDisplayReading(snap.status[sensor_sel], snap.min[sensor_sel]);
+			break;
+			case MODE_TEMP_MAX:
+				HAL_LEDS_ON(LED3);	HAL_LEDS_OFF(LED1|LED2|LED4|LED5); prvDisplayReading(snap.status[sensor_sel], snap.max[sensor_sel]);
+			break;
+			case MODE_TEMP_AVG:
+				HAL_LEDS_ON(LED2|LED3);	HAL_LEDS_OFF(LED1|LED4|LED5); prvDisplayReading(snap.status[sensor_sel], snap.avg[sensor_sel]);
+			break;
+			case MODE_TEMP_ALARM_MIN:
+				HAL_LEDS_ON(LED4);	HAL_LEDS_OFF(LED1|LED2|LED3|LED5); prvDisplayTemp(temp_alarm_min, 1);
+			break;
+			case MODE_TEMP_ALARM_MAX:
+				HAL_LEDS_ON(LED5);	HAL_LEDS_OFF(LED1|LED2|LED3|LED4); prvDisplayTemp(temp_alarm_max, 1);
+			break;
+			case MODE_SENSOR:
+				HAL_LEDS_OFF(LED1|LED2|LED3|LED4|LED5); prvDisplaySensor(sensor_sel);
+			break;
+			case MODE_RESOLUTION:
+				HAL_LEDS_OFF(LED1|LED2|LED3|LED4|LED5); prvDisplayResolution(fast_mode ? 9 : 12);
+			break;
+		}
+		//przekroczenie progu na którymkolwiek czujniku z poprawnym odczytem
+		alarm = 0;
+		for( i=0; i<sensors; i++ ){
+			if( DS18X20_OK != snap.status[i] ){ continue; }
+			if( (snap.act[i]<temp_alarm_min) || (snap.act[i]>temp_alarm_max) ){ alarm = 1; }
+		}
+		if( alarm ){ HAL_LEDS_ON(LED6); }
+		else{ HAL_LEDS_OFF(LED6); }
+	}
+}
+///pomiar temperatury - próbki do sample_queue
+static void vTaskMeasTemp(void *pvParameters);
+static void vTaskMeasTemp(void *pvParameters)
+{
+	static temp_sample_t sample;
+	uint8_t i, power, res = 0xFF, new_res, depth;
+	uint16_t tconv = DS18B20_TCONV_12BIT;
+	unsigned long last_wake, now;	//ticki rozszerzone - znaczniki czasu próbek rosną przez cały czas pracy
+
+	//czy któryś z czujników jest zasilany pasożytniczo
+	power = DS18X20_get_power_status( NULL );
+	//pierwszy pomiar od razu, kolejne co MEAS_PERIOD_MS
+	last_wake = ulTaskGetTickCountExtended() - MEAS_PERIOD_MS / portTICK_RATE_MS;
+
+	for( ;; )
+	{
+		//zmiana rozdzielczości (bez zapisu do EEPROM czujników), czas konwersji najwolniejszego czujnika
+		new_res = fast_mode ? MEAS_RES_FAST : MEAS_RES_NORMAL;
+		if( new_res != res ){
+			res = new_res;
+			tconv = 0;
+			for( i=0; i<sensors; i++ ){
+				DS18X20_set_resolution( gSensorIDs[i], res, power, 0 );
+				if( DS18X20_conv_time( gSensorIDs[i][0], res ) > tconv ){ tconv = DS18X20_conv_time( gSensorIDs[i][0], res ); }
+			}
+		}
+
+		//w trybie szybkim kolejny pomiar zaraz po poprzednim, w zwykłym w stałych odstępach MEAS_PERIOD_MS
+		if( fast_mode ){
+			last_wake = ulTaskGetTickCountExtended();
+		}
+		else{
+			vTaskDelayUntilExtended( &last_wake, MEAS_PERIOD_MS / portTICK_RATE_MS );
+			now = ulTaskGetTickCountExtended();
+			meas_late = now - last_wake;
+			if( meas_late > meas_late_max ){ meas_late_max = meas_late; }
+			//pomiar dłuższy niż okres - nowa podstawa zamiast serii pomiarów bez przerwy
+			if( meas_late >= MEAS_PERIOD_MS / portTICK_RATE_MS ){ meas_overruns++; last_wake = now; }
+		}
+
+		//jeden pomiar wszystkich czujników (SKIP ROM), odczyt zaraz po jego zakończeniu
+		DS18X20_start_meas( power, NULL );
+		DS18X20_wait_meas( power, tconv );
+		DS18X20_read_raw_all( sensors, sample.temp, sample.status );
+		sample.time = last_wake;
+
+		//bez czekania: pełna kolejka oznacza, że statystyki nie nadążają - próbka ginie i jest liczona
+		if( xQueueSend( sample_queue, &sample, 0 ) == pdTRUE ){
+			pipe.samples++;
+			depth = (uint8_t)uxQueueMessagesWaiting( sample_queue );
+			if( depth > pipe.sample_depth_max ){ pipe.sample_depth_max = depth; }
+		}
+		else{ pipe.samples_dropped++; }
+	}
+}
+
+
+///statystyki: min., maks. i średnia od zerowania; obsługuje naraz wszystkie czekające próbki
+///i publikuje jeden wynik w stats_queue
+static void vTaskStats(void *pvParameters);
+static void vTaskStats(void *pvParameters)
+{
+	static temp_sample_t sample;
+	static temp_stats_t st, stale;
+	static int32_t sum[MAXSENSORS];
+	static uint16_t count[MAXSENSORS];
+	static uint8_t fails[MAXSENSORS];	//nieudane odczyty z rzędu
+	uint8_t i, n, measured = 0;		//measured - czujniki z co najmniej jednym odczytem
+	keypad_event_t ev = EVENT_MEAS;
+
+	for( i=0; i<MAXSENSORS; i++ ){ st.status[i] = DS18X20_ERROR; }	//jeszcze bez pomiaru
+
+	for( ;; )
+	{
+		//portMAX_DELAY to tylko ok. 65.5s (INCLUDE_vTaskSuspend 0) - bez nowej próbki nic do zrobienia
+		if( xQueueReceive( sample_queue, &sample, portMAX_DELAY ) != pdTRUE ){ continue; }
+
+		//zerowanie od bieżącej temperatury
+		if( st.reset != reset_req ){
+			st.reset = reset_req;
+			for( i=0; i<sensors; i++ ){
+				st.min[i] = st.max[i] = st.act[i];
+				sum[i] = st.act[i];
+				count[i] = 1;
+			}
+		}
+
+		n = 0;
+		do {
+			n++;
+			st.time = sample.time;
+			for( i=0; i<sensors; i++ ){
+				if( DS18X20_OK != sample.status[i] ){
+					if( fails[i] < STATS_FAIL_SAMPLES ){ fails[i]++; }
+					if( (fails[i] >= STATS_FAIL_SAMPLES) || !(measured & (1<<i)) ){ st.status[i] = sample.status[i]; }
+					continue;
+				}
+				fails[i] = 0;
+				st.status[i] = DS18X20_OK;
+				st.act[i] = sample.temp[i];
+				if( !(measured & (1<<i)) ){
+					st.min[i] = st.max[i] = sample.temp[i];
+					sum[i] = 0;
+					count[i] = 0;
+					measured |= 1<<i;
+				}
+				if( sample.temp[i] < st.min[i] ){ st.min[i] = sample.temp[i]; }
+				if( sample.temp[i] > st.max[i] ){ st.max[i] = sample.temp[i]; }
+				//przed przepełnieniem licznika połowa sumy i licznika - średnia bez zmian
+				if( count[i] == 0xFFFF ){ sum[i] /= 2; count[i] /= 2; }
+				sum[i] += sample.temp[i];
+				count[i]++;
+			}
+		} while( xQueueReceive( sample_queue, &sample, 0 ) == pdTRUE );
+
+		for( i=0; i<sensors; i++ ){
+			if( count[i] ){ st.avg[i] = (int16_t)(sum[i] / count[i]); }
+		}
+		pipe.batches++;
+		if( n > pipe.batch_max ){ pipe.batch_max = n; }
+
+		//w stats_queue tylko najnowszy wynik - nieodebrany jest zastępowany
+		if( xQueueReceive( stats_queue, &stale, 0 ) == pdTRUE ){ pipe.stats_replaced++; }
+		xQueueSend( stats_queue, &st, 0 );
+
+		//odświeżenie wyświetlacza i diody alarmu; pełna kolejka - zadanie i tak ma zdarzenie do obsłużenia
+		xQueueSend( ui_queue, &ev, 0 );
+	}
+}
+
+/*-----------------------------------------------------------*/
+
+int main(void)
+{
+	prvInitHardware();
+
+	ui_queue = xQueueCreate( UI_QUEUE_LEN, sizeof( keypad_event_t ) );
+	sample_queue = xQueueCreate( SAMPLE_QUEUE_LEN, sizeof( temp_sample_t ) );
+	stats_queue = xQueueCreate( 1, sizeof( temp_stats_t ) );
+	keypad_init( ui_queue, KEY4|KEY5, 0 );
+
+	xTaskCreate( vTaskMeasTemp, 
+	             (const int8_t*) "vTaskMeasTemp",
+				 DS18B20_TASK_STACK_SIZE,
+				 NULL,
+				 DS18B20_TASK_PRIORITY,
+				 NULL);
+
+	xTaskCreate( vTaskStats,
+				(const int8_t*) "vTaskStats",
+				configMINIMAL_STACK_SIZE,
+				NULL,
+				STATS_TASK_PRIORITY,
+				NULL);
+				 
+	xTaskCreate( vTaskKeysLed,
+				(const int8_t*) "vTaskKeysLed",
+				configMINIMAL_STACK_SIZE,
+				NULL,
+				KEYS__LEDS_TASK_PRIORITY,
+				NULL);
+
+	vTaskStartScheduler();
+
+	for(;;);
+}
+/*-----------------------------------------------------------*/